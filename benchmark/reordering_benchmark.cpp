@@ -0,0 +1,104 @@
+#include "anagraph/algorithms/pagerank.hpp"
+#include "anagraph/algorithms/reordering.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace anagraph;
+
+    /**
+     * @brief Generate a graph of dense communities whose ids are shuffled.
+     * @param size The number of nodes
+     * @param communitySize The number of nodes in each community
+     * @param degree The number of edges added from each node
+     * @param seed The seed of the generator
+     *
+     * 90% of the edges stay inside the community, the others go to a random node.
+     */
+    graph_structure::WeightedDigraph generateGraph(int size, int communitySize, int degree, unsigned int seed) {
+        std::mt19937 gen(seed);
+        std::vector<int> ids(size);
+        std::iota(ids.begin(), ids.end(), 0);
+        std::shuffle(ids.begin(), ids.end(), gen);
+
+        std::uniform_int_distribution<int> nodeDis(0, size - 1);
+        std::uniform_int_distribution<int> memberDis(0, communitySize - 1);
+        std::uniform_real_distribution<double> realDis(0, 1);
+        graph_structure::WeightedDigraph graph;
+        for (int src = 0; src < size; src++) {
+            graph.setNode(ids[src]);
+        }
+        for (int src = 0; src < size; src++) {
+            const int communityBegin = src / communitySize * communitySize;
+            for (int i = 0; i < degree; i++) {
+                int dst = nodeDis(gen);
+                if (realDis(gen) < 0.9) {
+                    dst = std::min(size - 1, communityBegin + memberDis(gen));
+                }
+                graph.setEdge(ids[src], ids[dst], 1.0);
+            }
+        }
+        return graph;
+    }
+
+    double measureSeconds(const std::function<void()> &func) {
+        const auto begin = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - begin).count();
+    }
+
+    void runPageRank(const std::string &name, const graph_structure::WeightedDigraph &graph, int iter) {
+        const int size = graph.size();
+        std::vector<double> source(size, 1.0 / size);
+        const double pushSeconds = measureSeconds([&]() {
+            pagerank::forwardPush(graph, source, 0.15, 1e-5);
+        });
+        const double walkSeconds = measureSeconds([&]() {
+            pagerank::pageRank(graph, 0.15, iter);
+        });
+        spdlog::info("{:>20}: forwardPush {:.3f} s, pageRank {:.3f} s", name, pushSeconds, walkSeconds);
+    }
+}
+
+/**
+ * Usage: reordering_benchmark [size] [degree] [iter]
+ *
+ * Compare the time of PageRank on a graph with shuffled ids and on the graph reordered by each strategy.
+ */
+int main(int argc, char *argv[]) {
+    const int size = argc > 1 ? std::stoi(argv[1]) : 100000;
+    const int degree = argc > 2 ? std::stoi(argv[2]) : 8;
+    const int iter = argc > 3 ? std::stoi(argv[3]) : 1000000;
+
+    spdlog::info("generate a graph with {} nodes and {} edges per node", size, degree);
+    graph_structure::WeightedDigraph graph = generateGraph(size, 64, degree, 42);
+    runPageRank("shuffled", graph, iter);
+
+    const std::vector<std::pair<std::string, std::function<std::unordered_map<int, int>(const graph_structure::WeightedDigraph&)>>> strategies = {
+        {"degreeOrder", [](const auto &graph) { return reordering::degreeOrder(graph); }},
+        {"reverseCuthillMcKee", [](const auto &graph) { return reordering::reverseCuthillMcKee(graph); }},
+        {"communityOrder", [](const auto &graph) { return reordering::communityOrder(graph); }},
+    };
+    for (const auto &[name, strategy] : strategies) {
+        graph_structure::WeightedDigraph reordered = graph;
+        std::unordered_map<int, int> idMap;
+        const double orderSeconds = measureSeconds([&]() {
+            idMap = strategy(reordered);
+        });
+        const double relabelSeconds = measureSeconds([&]() {
+            reordered.relabel(idMap);
+        });
+        spdlog::info("{:>20}: ordering {:.3f} s, relabel {:.3f} s", name, orderSeconds, relabelSeconds);
+        runPageRank(name, reordered, iter);
+    }
+    return 0;
+}
\ No newline at end of file
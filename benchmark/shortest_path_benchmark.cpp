@@ -0,0 +1,92 @@
+#include "anagraph/algorithms/shortest_path.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+
+namespace {
+    using namespace anagraph;
+
+    const std::string datasetFile = PROJECT_SOURCE_DIR + std::string("/dataset/zackary_karate.txt");
+
+    /**
+     * @brief Generate a random digraph with uniform weights in [1, 100).
+     * @param size The number of nodes
+     * @param degree The number of edges added from each node
+     * @param seed The seed of the generator
+     */
+    graph_structure::WeightedDigraph generateGraph(int size, int degree, unsigned int seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> nodeDis(0, size - 1);
+        std::uniform_real_distribution<double> weightDis(1.0, 100.0);
+        graph_structure::WeightedDigraph graph;
+        for (int src = 0; src < size; src++) {
+            graph.setNode(src);
+        }
+        for (int src = 0; src < size; src++) {
+            for (int i = 0; i < degree; i++) {
+                graph.setEdge(src, nodeDis(gen), weightDis(gen));
+            }
+        }
+        return graph;
+    }
+
+    double measureSeconds(const std::function<void()> &func) {
+        const auto begin = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - begin).count();
+    }
+
+    void runShortestPath(const std::string &name, const graph_structure::CompressedGraph &graph, int repeat) {
+        const int source = graph.getId(0);
+        double meanWeight = 0.0;
+        for (const double weight : graph.getWeights()) {
+            meanWeight += weight / graph.edgeSize();
+        }
+        const int threads = parallel::defaultThreadCount();
+
+        const double dijkstraSeconds = measureSeconds([&]() {
+            for (int i = 0; i < repeat; i++) {
+                shortest_path::dijkstra(graph, source);
+            }
+        });
+        spdlog::info("{:>10}: dijkstra {:.6f} s", name, dijkstraSeconds / repeat);
+        for (const double scale : {0.25, 1.0, 4.0}) {
+            const double delta = meanWeight * scale;
+            const double serialSeconds = measureSeconds([&]() {
+                for (int i = 0; i < repeat; i++) {
+                    shortest_path::deltaStepping(graph, source, delta, 1);
+                }
+            });
+            const double parallelSeconds = measureSeconds([&]() {
+                for (int i = 0; i < repeat; i++) {
+                    shortest_path::deltaStepping(graph, source, delta, threads);
+                }
+            });
+            spdlog::info("{:>10}: deltaStepping(delta = {:.2f}) {:.6f} s on 1 thread, {:.6f} s on {} threads", name, delta, serialSeconds / repeat, parallelSeconds / repeat, threads);
+        }
+    }
+}
+
+/**
+ * Usage: shortest_path_benchmark [size] [degree]
+ *
+ * Compare the time of Dijkstra's algorithm and delta-stepping on the karate club and on a generated graph.
+ */
+int main(int argc, char *argv[]) {
+    const int size = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const int degree = argc > 2 ? std::stoi(argv[2]) : 8;
+
+    const graph_structure::WeightedGraph karate(datasetFile, FileExtension::TXT);
+    runShortestPath("karate", graph_structure::CompressedGraph(karate), 1000);
+
+    spdlog::info("generate a graph with {} nodes and {} edges per node", size, degree);
+    const graph_structure::CompressedGraph generated(generateGraph(size, degree, 42));
+    runShortestPath("generated", generated, 1);
+    return 0;
+}
\ No newline at end of file
@@ -5,5 +5,17 @@
 
 #include "anagraph/algorithms/pagerank.hpp"
 #include "anagraph/algorithms/similarity.hpp"
+#include "anagraph/algorithms/reordering.hpp"
+#include "anagraph/algorithms/summarization.hpp"
+#include "anagraph/algorithms/summary_query.hpp"
+#include "anagraph/algorithms/decompression.hpp"
+#include "anagraph/algorithms/bfs.hpp"
+#include "anagraph/algorithms/shortest_path.hpp"
+#include "anagraph/algorithms/connectivity.hpp"
+#include "anagraph/algorithms/triangles.hpp"
+#include "anagraph/algorithms/core_decomposition.hpp"
+#include "anagraph/algorithms/community.hpp"
+#include "anagraph/algorithms/local_clustering.hpp"
+#include "anagraph/algorithms/centrality.hpp"
 
 #endif // GRAPH_ALGORITHM_HPP
\ No newline at end of file
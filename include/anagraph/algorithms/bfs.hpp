@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef BFS_HPP
+#define BFS_HPP
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/unweighted_digraph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+
+#include <vector>
+
+namespace anagraph {
+namespace bfs {
+
+/**
+ * @brief The distance and the parent of a node which is not reached from the source.
+ */
+constexpr int UNREACHED = -1;
+
+/**
+ * @struct BFSResult
+ * @brief The tree of a breadth-first search.
+ *
+ * @note Both vectors are indexed by the position of the node in the ascending ids, i.e. the index of CompressedGraph.
+ */
+struct BFSResult {
+    std::vector<int> distances; /**< The number of hops from the source, UNREACHED if the node is not reached */
+    std::vector<int> parents; /**< The id of the parent, the source for itself, UNREACHED if the node is not reached */
+};
+
+/**
+ * @brief Search a digraph in the breadth-first order from a source.
+ *
+ * @param graph The digraph
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note The search runs on 1 thread. If the source does not exist, throw an exception.
+ */
+BFSResult breadthFirstSearch(const graph_structure::Digraph &graph, int source);
+
+/**
+ * @brief Search a digraph in the breadth-first order from a source.
+ *
+ * @param graph The digraph
+ * @param source The id of the source node
+ * @param numThreads The number of threads to expand each level
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note If the source does not exist, throw an exception.
+ */
+BFSResult breadthFirstSearch(const graph_structure::Digraph &graph, int source, int numThreads);
+
+/**
+ * @brief Search a graph in the breadth-first order from a source.
+ *
+ * @param graph The graph
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note The search runs on 1 thread. If the source does not exist, throw an exception.
+ */
+BFSResult breadthFirstSearch(const graph_structure::Graph &graph, int source);
+
+/**
+ * @brief Search a graph in the breadth-first order from a source.
+ *
+ * @param graph The graph
+ * @param source The id of the source node
+ * @param numThreads The number of threads to expand each level
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note If the source does not exist, throw an exception.
+ */
+BFSResult breadthFirstSearch(const graph_structure::Graph &graph, int source, int numThreads);
+
+/**
+ * @brief Search a compressed graph in the breadth-first order from a source, switching between the directions.
+ *
+ * Each level is expanded either top-down, from the frontier along the out-edges,
+ * or bottom-up, from each unvisited node along its in-edges until a parent in the frontier is found.
+ * The search goes bottom-up while the edges of the frontier outnumber 1/14 of the unexplored edges,
+ * and goes back top-down when the frontier shrinks below 1/24 of the nodes.
+ *
+ * @param graph The compressed graph
+ * @param transposed The transpose of the graph, or the graph itself if it is undirected
+ * @param source The id of the source node
+ * @param numThreads The number of threads to expand each level
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note The compressed graphs can be built once and searched from many sources.
+ * The frontier of the bottom-up levels is a bitmap.
+ * The parent of each node is the one with the smallest index in the previous level,
+ * so the result does not depend on the number of threads nor on the directions.
+ * If the source does not exist, throw an exception.
+ */
+BFSResult breadthFirstSearch(const graph_structure::CompressedGraph &graph, const graph_structure::CompressedGraph &transposed, int source, int numThreads);
+
+} // namespace bfs
+} // namespace anagraph
+
+#endif // BFS_HPP
\ No newline at end of file
@@ -0,0 +1,324 @@
+#pragma once
+
+#ifndef CENTRALITY_HPP
+#define CENTRALITY_HPP
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/unweighted_digraph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+#include "anagraph/components/weighted_digraph.hpp"
+#include "anagraph/components/weighted_graph.hpp"
+
+#include <vector>
+
+namespace anagraph {
+namespace centrality {
+
+/*
+ * The centralities of the nodes along the shortest paths.
+ * The betweenness of a node v is the sum of sigma_st(v) / sigma_st over the pairs of the other nodes s and t,
+ * where sigma_st is the number of the shortest paths from s to t and sigma_st(v) is the number of them passing v.
+ * A pair of an undirected graph is counted once, so the betweenness is half of the one over the ordered pairs.
+ * The weights are the lengths of the edges, and the shortest paths of an unweighted graph are counted by the hops.
+ * The harmonic centrality of a node v is the sum of 1 / d(v, u), and the closeness is (r - 1) / sum d(v, u),
+ * over the r nodes u reached from v, including v itself, where d is the number of the hops.
+ * The vectors are indexed by the position of the node in the ascending ids, i.e. the index of CompressedGraph.
+ */
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The graph
+ * @return The betweenness of each node
+ */
+std::vector<double> betweenness(const graph_structure::Graph &graph);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The graph
+ * @param numThreads The number of threads to search from the sources
+ * @return The betweenness of each node
+ */
+std::vector<double> betweenness(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The digraph
+ * @return The betweenness of each node
+ */
+std::vector<double> betweenness(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The digraph
+ * @param numThreads The number of threads to search from the sources
+ * @return The betweenness of each node
+ */
+std::vector<double> betweenness(const graph_structure::Digraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The graph with positive weights
+ * @return The betweenness of each node
+ *
+ * @note If a weight is not positive, throw std::invalid_argument.
+ */
+std::vector<double> betweenness(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The graph with positive weights
+ * @param numThreads The number of threads to search from the sources
+ * @return The betweenness of each node
+ *
+ * @note If a weight is not positive, throw std::invalid_argument.
+ */
+std::vector<double> betweenness(const graph_structure::WeightedGraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The digraph with positive weights
+ * @return The betweenness of each node
+ *
+ * @note If a weight is not positive, throw std::invalid_argument.
+ */
+std::vector<double> betweenness(const graph_structure::WeightedDigraph &graph);
+
+/**
+ * @brief Calculate the betweenness of each node.
+ * @param graph The digraph with positive weights
+ * @param numThreads The number of threads to search from the sources
+ * @return The betweenness of each node
+ *
+ * @note If a weight is not positive, throw std::invalid_argument.
+ */
+std::vector<double> betweenness(const graph_structure::WeightedDigraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the betweenness of each node of a compressed graph by Brandes' algorithm.
+ *
+ * The shortest paths from each source are counted by BFS if every weight is 1, otherwise by Dijkstra's algorithm,
+ * and then the dependencies of the source on the nodes are accumulated in the reverse order of the distances.
+ * The sources are split into contiguous blocks, and each thread accumulates its block into its own vector,
+ * which are summed at the end, so the cost is O(nm) for an unweighted graph on the threads.
+ *
+ * @param graph The compressed graph with positive weights
+ * @param isUndirected Whether each edge is stored in both directions, to count each pair once
+ * @param numThreads The number of threads to search from the sources
+ * @return The betweenness of each node
+ *
+ * @note If a weight is not positive, throw std::invalid_argument.
+ */
+std::vector<double> betweenness(const graph_structure::CompressedGraph &graph, bool isUndirected, int numThreads);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The graph
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::Graph &graph, double epsilon, double delta);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The graph
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @param numThreads The number of threads to search from the sources
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::Graph &graph, double epsilon, double delta, int numThreads);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The digraph
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::Digraph &graph, double epsilon, double delta);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The digraph
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @param numThreads The number of threads to search from the sources
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::Digraph &graph, double epsilon, double delta, int numThreads);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The graph with positive weights
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::WeightedGraph &graph, double epsilon, double delta);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The graph with positive weights
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @param numThreads The number of threads to search from the sources
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::WeightedGraph &graph, double epsilon, double delta, int numThreads);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The digraph with positive weights
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::WeightedDigraph &graph, double epsilon, double delta);
+
+/**
+ * @brief Estimate the betweenness of each node by sampling the sources.
+ * @param graph The digraph with positive weights
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @param numThreads The number of threads to search from the sources
+ * @return The estimated betweenness of each node
+ */
+std::vector<double> estimateBetweenness(const graph_structure::WeightedDigraph &graph, double epsilon, double delta, int numThreads);
+
+/**
+ * @brief Estimate the betweenness of each node of a compressed graph by sampling the sources.
+ *
+ * The dependencies on the nodes are accumulated only from k sources sampled uniformly with replacement,
+ * and scaled by n / k. The dependency of a source on a node is at most n - 2, so by Hoeffding's inequality
+ * and the union bound over the nodes, k = ln(2n / delta) / (2 epsilon^2) sources bound the error of every node
+ * by epsilon n (n - 2), or half of it for an undirected graph, with the probability of at least 1 - delta.
+ * If k is not less than n, the betweenness is calculated exactly instead.
+ *
+ * @param graph The compressed graph with positive weights
+ * @param isUndirected Whether each edge is stored in both directions, to count each pair once
+ * @param epsilon The error bound relative to the number of the pairs
+ * @param delta The probability that the error bound fails
+ * @param numThreads The number of threads to search from the sources
+ * @return The estimated betweenness of each node
+ *
+ * @note The sources are drawn from a fixed seed, so the sampled sources do not depend on the number of threads.
+ * If epsilon or delta is not in (0, 1), or a weight is not positive, throw std::invalid_argument.
+ */
+std::vector<double> estimateBetweenness(const graph_structure::CompressedGraph &graph, bool isUndirected, double epsilon, double delta, int numThreads);
+
+/**
+ * @brief Estimate the harmonic centrality of each node by HyperBall.
+ * @param graph The graph
+ * @return The estimated harmonic centrality of each node
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> harmonicCentrality(const graph_structure::Graph &graph);
+
+/**
+ * @brief Estimate the harmonic centrality of each node by HyperBall.
+ * @param graph The graph
+ * @param numThreads The number of threads to update the counters
+ * @return The estimated harmonic centrality of each node
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> harmonicCentrality(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Estimate the harmonic centrality of each node by HyperBall, over the distances from the node.
+ * @param graph The digraph
+ * @return The estimated harmonic centrality of each node
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> harmonicCentrality(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Estimate the harmonic centrality of each node by HyperBall, over the distances from the node.
+ * @param graph The digraph
+ * @param numThreads The number of threads to update the counters
+ * @return The estimated harmonic centrality of each node
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> harmonicCentrality(const graph_structure::Digraph &graph, int numThreads);
+
+/**
+ * @brief Estimate the harmonic centrality of each node of a compressed graph by HyperBall.
+ *
+ * Each node has a HyperLogLog counter of the nodes within t hops, starting from the node itself at t = 0.
+ * Each pass takes the union of the counters of the node and its adjacents, i.e. the register-wise maximum,
+ * into a second array in parallel, and the growth of the estimated size is the number of the nodes at t hops.
+ * Only the nodes with a changed adjacent are updated, and the passes stop when no counter changes,
+ * so the number of the passes is the diameter plus 1.
+ *
+ * @param graph The compressed graph, whose weights are ignored
+ * @param log2m The logarithm of the number of the registers per counter,
+ * whose relative standard error is 1.04 / sqrt(2^log2m) and memory is 2^log2m bytes per node
+ * @param numThreads The number of threads to update the counters
+ * @return The estimated harmonic centrality of each node
+ *
+ * @note The counters are updated synchronously, so the result does not depend on the number of threads.
+ * If log2m is not in [4, 16], throw std::invalid_argument.
+ */
+std::vector<double> harmonicCentrality(const graph_structure::CompressedGraph &graph, int log2m, int numThreads);
+
+/**
+ * @brief Estimate the closeness centrality of each node by HyperBall.
+ * @param graph The graph
+ * @return The estimated closeness centrality of each node, 0.0 if no other node is reached
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> closenessCentrality(const graph_structure::Graph &graph);
+
+/**
+ * @brief Estimate the closeness centrality of each node by HyperBall.
+ * @param graph The graph
+ * @param numThreads The number of threads to update the counters
+ * @return The estimated closeness centrality of each node, 0.0 if no other node is reached
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> closenessCentrality(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Estimate the closeness centrality of each node by HyperBall, over the distances from the node.
+ * @param graph The digraph
+ * @return The estimated closeness centrality of each node, 0.0 if no other node is reached
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> closenessCentrality(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Estimate the closeness centrality of each node by HyperBall, over the distances from the node.
+ * @param graph The digraph
+ * @param numThreads The number of threads to update the counters
+ * @return The estimated closeness centrality of each node, 0.0 if no other node is reached
+ *
+ * @note Each node has a HyperLogLog counter of 2^10 registers.
+ */
+std::vector<double> closenessCentrality(const graph_structure::Digraph &graph, int numThreads);
+
+/**
+ * @brief Estimate the closeness centrality of each node of a compressed graph by HyperBall.
+ *
+ * The sum of the distances and the number of the reached nodes are estimated by the same passes as harmonicCentrality.
+ *
+ * @param graph The compressed graph, whose weights are ignored
+ * @param log2m The logarithm of the number of the registers per counter
+ * @param numThreads The number of threads to update the counters
+ * @return The estimated closeness centrality of each node, 0.0 if no other node is reached
+ *
+ * @note The counters are updated synchronously, so the result does not depend on the number of threads.
+ * If log2m is not in [4, 16], throw std::invalid_argument.
+ */
+std::vector<double> closenessCentrality(const graph_structure::CompressedGraph &graph, int log2m, int numThreads);
+
+} // namespace centrality
+} // namespace anagraph
+
+#endif // CENTRALITY_HPP
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef COMMUNITY_HPP
+#define COMMUNITY_HPP
+
+#include "anagraph/components/weighted_graph.hpp"
+#include "anagraph/components/weighted_supergraph.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace anagraph {
+namespace community {
+
+/*
+ * The community detection maximizing the modularity
+ * Q = 1 / 2m sum_{i,j} (A_ij - resolution k_i k_j / 2m) [c_i = c_j],
+ * where k_i is the weighted degree of a node, counting a self-loop twice, and 2m is the sum of the degrees.
+ *
+ * Each level moves the nodes between the communities, and then aggregates each community into a node of the next level.
+ * The result is a WeightedSupergraph whose leaves are the nodes and edges of the graph,
+ * where each aggregation of 2 or more nodes is a supernode whose children are the aggregated nodes,
+ * and whose root supernodes are the communities, e.g. getHierarchyIndex().getRoot(id) is the community of a node.
+ * The label propagation gives the same kind of hierarchy with a single level, without optimizing the modularity,
+ * but in far fewer passes over the edges on very large graphs.
+ */
+
+/**
+ * @brief Detect the communities of a graph by the Louvain method.
+ * @param graph The graph with non-negative weights
+ * @return The hierarchy of the communities
+ *
+ * @note The resolution is 1.0 and the nodes are moved on 1 thread.
+ */
+graph_structure::WeightedSupergraph louvain(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Detect the communities of a graph by the Louvain method.
+ *
+ * The nodes of each level are moved to the adjacent community of the largest modularity gain until no node moves,
+ * and each community becomes a node of the next level, until no community is merged.
+ *
+ * @param graph The graph with non-negative weights
+ * @param resolution The resolution, a larger one gives smaller communities
+ * @param numThreads The number of threads to move the nodes
+ * @return The hierarchy of the communities
+ *
+ * @note The nodes are moved in 8 fixed batches, and the nodes of a batch choose their communities in parallel
+ * against the communities after the previous batch, so the result does not depend on the number of threads.
+ * If a weight is negative or the resolution is not positive, throw std::invalid_argument.
+ */
+graph_structure::WeightedSupergraph louvain(const graph_structure::WeightedGraph &graph, double resolution, int numThreads);
+
+/**
+ * @brief Detect the communities of a graph by the Leiden algorithm.
+ * @param graph The graph with non-negative weights
+ * @return The hierarchy of the communities
+ *
+ * @note The resolution is 1.0 and the nodes are moved on 1 thread.
+ */
+graph_structure::WeightedSupergraph leiden(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Detect the communities of a graph by the Leiden algorithm.
+ *
+ * The nodes are moved as louvain, and then each community is refined into well-connected sub-communities,
+ * merging each singleton node into the sub-community of the largest modularity gain within its community.
+ * The sub-communities become the nodes of the next level, starting in the communities before the refinement,
+ * so that a community is never aggregated from disconnected parts.
+ *
+ * @param graph The graph with non-negative weights
+ * @param resolution The resolution, a larger one gives smaller communities
+ * @param numThreads The number of threads to move and refine the nodes
+ * @return The hierarchy of the communities
+ *
+ * @note The refinement is greedy instead of randomized, so the result does not depend on the number of threads.
+ * If a weight is negative or the resolution is not positive, throw std::invalid_argument.
+ */
+graph_structure::WeightedSupergraph leiden(const graph_structure::WeightedGraph &graph, double resolution, int numThreads);
+
+/**
+ * @brief Detect the communities of a graph by the label propagation.
+ * @param graph The graph with non-negative weights
+ * @return The hierarchy of the communities
+ *
+ * @note The labels are propagated in the deterministic mode on 1 thread, until less than 0.1% of the nodes change.
+ */
+graph_structure::WeightedSupergraph labelPropagation(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Detect the communities of a graph by the asynchronous label propagation.
+ *
+ * Each node takes the label of the largest total weight among its neighbors, keeping its own label on a tie,
+ * or else taking the smallest one. The threads update the labels in place, so that a node sees the labels
+ * already updated by the other threads in the same iteration, which converges faster than the synchronous updates.
+ *
+ * @param graph The graph with non-negative weights
+ * @param threshold The ratio of the changed nodes in an iteration below which the propagation stops
+ * @param numThreads The number of threads to update the labels
+ * @return The hierarchy of the communities, with at most one level of supernodes
+ *
+ * @note The result depends on the scheduling of the threads. The propagation stops after 100 iterations at most.
+ * If a weight is negative or the threshold is not in [0, 1], throw std::invalid_argument.
+ */
+graph_structure::WeightedSupergraph labelPropagation(const graph_structure::WeightedGraph &graph, double threshold, int numThreads);
+
+/**
+ * @brief Detect the communities of a graph by the label propagation in the deterministic mode.
+ *
+ * The nodes are shuffled by the seed in each iteration and split into 8 batches,
+ * and the nodes of a batch choose their labels in parallel against the labels after the previous batch.
+ *
+ * @param graph The graph with non-negative weights
+ * @param threshold The ratio of the changed nodes in an iteration below which the propagation stops
+ * @param numThreads The number of threads to update the labels
+ * @param seed The seed to shuffle the nodes
+ * @return The hierarchy of the communities, with at most one level of supernodes
+ *
+ * @note The result depends only on the graph and the seed, not on the number of threads.
+ * If a weight is negative or the threshold is not in [0, 1], throw std::invalid_argument.
+ */
+graph_structure::WeightedSupergraph labelPropagation(const graph_structure::WeightedGraph &graph, double threshold, int numThreads, uint64_t seed);
+
+/**
+ * @brief Calculate the modularity of the communities of a graph.
+ * @param graph The graph
+ * @param communities The label of the community of each node, indexed by the index of CompressedGraph
+ * @return The modularity
+ */
+double modularity(const graph_structure::WeightedGraph &graph, const std::vector<int> &communities);
+
+/**
+ * @brief Calculate the modularity of the communities of a graph.
+ * @param graph The graph
+ * @param communities The label of the community of each node, indexed by the index of CompressedGraph
+ * @param resolution The resolution
+ * @return The modularity
+ *
+ * @note If the size of communities does not match the graph, throw std::invalid_argument.
+ */
+double modularity(const graph_structure::WeightedGraph &graph, const std::vector<int> &communities, double resolution);
+
+} // namespace community
+} // namespace anagraph
+
+#endif // COMMUNITY_HPP
\ No newline at end of file
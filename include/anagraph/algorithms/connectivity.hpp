@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef CONNECTIVITY_HPP
+#define CONNECTIVITY_HPP
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/unweighted_digraph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+#include "anagraph/components/weighted_digraph.hpp"
+#include "anagraph/components/weighted_graph.hpp"
+
+#include <vector>
+
+namespace anagraph {
+namespace connectivity {
+
+/*
+ * The connected components of a graph, e.g. to split a graph before pagerank::pageRank.
+ * Each function returns the label of every node, indexed by the position of the node in the ascending ids
+ * (the index of CompressedGraph), and the label of a component is the smallest id in it.
+ * The nodes of a component can be viewed as a graph by SubgraphView.
+ */
+
+/**
+ * @brief Calculate the connected components of a graph.
+ * @param graph The graph
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::Graph &graph);
+
+/**
+ * @brief Calculate the connected components of a graph.
+ * @param graph The graph
+ * @param numThreads The number of threads to unite the nodes
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Calculate the connected components of a graph.
+ * @param graph The graph
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Calculate the connected components of a graph.
+ * @param graph The graph
+ * @param numThreads The number of threads to unite the nodes
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedGraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the weakly connected components of a digraph, i.e. ignoring the directions of the edges.
+ * @param graph The digraph
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Calculate the weakly connected components of a digraph, i.e. ignoring the directions of the edges.
+ * @param graph The digraph
+ * @param numThreads The number of threads to unite the nodes
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::Digraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the weakly connected components of a digraph, i.e. ignoring the directions of the edges.
+ * @param graph The digraph
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedDigraph &graph);
+
+/**
+ * @brief Calculate the weakly connected components of a digraph, i.e. ignoring the directions of the edges.
+ * @param graph The digraph
+ * @param numThreads The number of threads to unite the nodes
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedDigraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the weakly connected components of a compressed graph by Afforest.
+ *
+ * The nodes are united along the edges by a lock-free union-find, where a root is always linked to a smaller index.
+ * First only the first 2 edges of each node are united, which already joins most of the nodes of a large component.
+ * Then the largest component is estimated from 1024 sampled nodes,
+ * and only the nodes outside of it have to unite the rest of their edges.
+ *
+ * @param graph The compressed graph
+ * @param isUndirected Whether each edge is stored in both directions, otherwise no node can be skipped
+ * @param numThreads The number of threads to unite the nodes
+ * @return The smallest id in the component of each node
+ *
+ * @note The result does not depend on the number of threads.
+ */
+std::vector<int> weaklyConnectedComponents(const graph_structure::CompressedGraph &graph, bool isUndirected, int numThreads);
+
+/**
+ * @brief Calculate the strongly connected components of a digraph.
+ * @param graph The digraph
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> stronglyConnectedComponents(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Calculate the strongly connected components of a digraph.
+ * @param graph The digraph
+ * @return The smallest id in the component of each node
+ */
+std::vector<int> stronglyConnectedComponents(const graph_structure::WeightedDigraph &graph);
+
+/**
+ * @brief Calculate the strongly connected components of a compressed digraph by Tarjan's algorithm.
+ * @param graph The compressed digraph
+ * @return The smallest id in the component of each node
+ *
+ * @note The depth-first search keeps its own stack, so that a long path does not overflow the call stack.
+ * The cost is O(n + m) on a single thread.
+ */
+std::vector<int> stronglyConnectedComponents(const graph_structure::CompressedGraph &graph);
+
+} // namespace connectivity
+} // namespace anagraph
+
+#endif // CONNECTIVITY_HPP
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#ifndef CORE_DECOMPOSITION_HPP
+#define CORE_DECOMPOSITION_HPP
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/subgraph_view.hpp"
+#include "anagraph/components/unweighted_digraph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+
+#include <vector>
+
+namespace anagraph {
+namespace core_decomposition {
+
+/*
+ * The k-core of a graph is the largest subgraph in which every node has at least k neighbors,
+ * and the core number of a node is the largest k such that the k-core contains the node.
+ * The directions of the edges and the self-loops are ignored, so the neighbors of a node in a digraph
+ * are the union of its in-neighbors and out-neighbors.
+ * The core numbers are indexed by the position of the node in the ascending ids, i.e. the index of CompressedGraph.
+ *
+ * Removing the nodes of low cores shrinks a graph before a costly algorithm, e.g. pagerank::fora
+ * on the k-core materialized and reorganized to sequential ids.
+ */
+
+/**
+ * @brief Calculate the core number of each node of a graph.
+ * @param graph The graph
+ * @return The core number of each node
+ */
+std::vector<int> coreNumbers(const graph_structure::Graph &graph);
+
+/**
+ * @brief Calculate the core number of each node of a graph.
+ * @param graph The graph
+ * @param numThreads The number of threads to peel the nodes
+ * @return The core number of each node
+ */
+std::vector<int> coreNumbers(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Calculate the core number of each node of a digraph, ignoring the directions of the edges.
+ * @param graph The digraph
+ * @return The core number of each node
+ */
+std::vector<int> coreNumbers(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Calculate the core number of each node of a digraph, ignoring the directions of the edges.
+ * @param graph The digraph
+ * @param numThreads The number of threads to peel the nodes
+ * @return The core number of each node
+ */
+std::vector<int> coreNumbers(const graph_structure::Digraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the core number of each node of a compressed graph by the bucket peeling of Batagelj and Zaversnik.
+ *
+ * The nodes are sorted into buckets by their degrees, and the node of the smallest degree is removed one by one.
+ * Removing a node moves each of its remaining neighbors to the bucket of one smaller degree in O(1),
+ * so the cost is O(n + m) on a single thread.
+ *
+ * @param graph The compressed graph
+ * @param transposed The transposed graph of graph, or graph itself if each edge is stored in both directions
+ * @return The core number of each node
+ *
+ * @note If the sizes of the graphs do not match, throw std::invalid_argument.
+ */
+std::vector<int> coreNumbers(const graph_structure::CompressedGraph &graph, const graph_structure::CompressedGraph &transposed);
+
+/**
+ * @brief Calculate the core number of each node of a compressed graph by the level-synchronous peeling.
+ *
+ * For each k from the smallest degree, all the remaining nodes of degree at most k are removed at once in parallel,
+ * decrementing the degrees of their neighbors atomically,
+ * and the neighbors whose degree falls to k are removed in the next round, until no node of degree k is left.
+ *
+ * @param graph The compressed graph
+ * @param transposed The transposed graph of graph, or graph itself if each edge is stored in both directions
+ * @param numThreads The number of threads to peel the nodes
+ * @return The core number of each node
+ *
+ * @note Each level scans the remaining nodes, so the cost is O(n k_max + m) in total.
+ * The result is the same as the sequential peeling.
+ * If the sizes of the graphs do not match, throw std::invalid_argument.
+ */
+std::vector<int> coreNumbers(const graph_structure::CompressedGraph &graph, const graph_structure::CompressedGraph &transposed, int numThreads);
+
+/**
+ * @brief Get the k-core of a graph as a view.
+ * @param graph The graph
+ * @param k The minimum degree of the core
+ * @return The view of the nodes whose core number is at least k
+ *
+ * @note The view refers to graph, which must outlive the view.
+ */
+graph_structure::SubgraphView<graph_structure::Graph> kCore(const graph_structure::Graph &graph, int k);
+
+/**
+ * @brief Get the k-core of a digraph as a view, ignoring the directions of the edges.
+ * @param graph The digraph
+ * @param k The minimum degree of the core
+ * @return The view of the nodes whose core number is at least k
+ *
+ * @note The view refers to graph, which must outlive the view.
+ */
+graph_structure::SubgraphView<graph_structure::Digraph> kCore(const graph_structure::Digraph &graph, int k);
+
+} // namespace core_decomposition
+} // namespace anagraph
+
+#endif // CORE_DECOMPOSITION_HPP
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef DECOMPRESSION_HPP
+#define DECOMPRESSION_HPP
+
+#include "anagraph/components/correction_set.hpp"
+#include "anagraph/components/weighted_directed_supergraph.hpp"
+#include "anagraph/components/weighted_supergraph.hpp"
+
+#include <functional>
+
+namespace anagraph {
+namespace decompression {
+
+/*
+ * The lossless encoding of a summary, i.e. the hierarchy of a supergraph and the corrections between its root supernodes.
+ * Once encoded, the edges between the leaves are not needed any more, and the original graph is restored
+ * by streaming the edges of each pair of root supernodes from the leaves of the hierarchy and the corrections.
+ */
+
+/**
+ * @brief Encode the edges between the leaves of a supergraph as superedges and corrections.
+ *
+ * @param summary The supergraph whose leaves are the nodes and edges of the original graph, e.g. the result of summarization::summarize
+ *
+ * @return The corrections grouped by the pair of root supernodes
+ *
+ * @note For each pair of root supernodes, the cheaper of a superedge with its removals and re-weighted additions,
+ * or the edges themselves as additions, is chosen.
+ * The superedge implies the most frequent weight of the edges. A self loop of a leaf is always an addition.
+ */
+graph_structure::CorrectionSet encode(const graph_structure::WeightedSupergraph &summary);
+
+/**
+ * @brief Encode the edges between the leaves of a superdigraph as superedges and corrections.
+ *
+ * @param summary The superdigraph whose leaves are the nodes and edges of the original digraph
+ *
+ * @return The corrections grouped by the pair of root supernodes
+ *
+ * @note For each pair of root supernodes, the cheaper of a superedge with its removals and re-weighted additions,
+ * or the edges themselves as additions, is chosen.
+ * The superedge implies the most frequent weight of the edges. A self loop of a leaf is always an addition.
+ */
+graph_structure::CorrectionSet encode(const graph_structure::WeightedSuperDigraph &summary);
+
+/**
+ * @brief Stream the edges of the original graph.
+ *
+ * @param summary The supergraph which gives the hierarchy, its edges are not read
+ * @param corrections The corrections encoded against the same hierarchy
+ * @param emit The function called with (src, dst, weight) for each edge, once with src <= dst
+ *
+ * @note The edges are emitted in ascending order of the pair of root supernodes,
+ * and only the edges of one pair are held at a time.
+ * If the corrections are of a directed graph, throw std::invalid_argument.
+ */
+void decompress(const graph_structure::WeightedSupergraph &summary, const graph_structure::CorrectionSet &corrections, const std::function<void(int, int, double)> &emit);
+
+/**
+ * @brief Stream the edges of the original graph between the leaves of two root supernodes.
+ *
+ * @param summary The supergraph which gives the hierarchy, its edges are not read
+ * @param corrections The corrections encoded against the same hierarchy
+ * @param first The first root supernode
+ * @param second The second root supernode
+ * @param emit The function called with (src, dst, weight) for each edge, once with src <= dst
+ *
+ * @note If a supernode does not exist, throw std::out_of_range, and if it is not a root, throw std::invalid_argument.
+ */
+void decompress(const graph_structure::WeightedSupergraph &summary, const graph_structure::CorrectionSet &corrections, int first, int second, const std::function<void(int, int, double)> &emit);
+
+/**
+ * @brief Stream the edges of the original digraph.
+ *
+ * @param summary The superdigraph which gives the hierarchy, its edges are not read
+ * @param corrections The corrections encoded against the same hierarchy
+ * @param emit The function called with (src, dst, weight) for each edge
+ *
+ * @note The edges are emitted in ascending order of the pair of root supernodes,
+ * and only the edges of one pair are held at a time.
+ * If the corrections are of an undirected graph, throw std::invalid_argument.
+ */
+void decompress(const graph_structure::WeightedSuperDigraph &summary, const graph_structure::CorrectionSet &corrections, const std::function<void(int, int, double)> &emit);
+
+/**
+ * @brief Stream the edges of the original digraph from the leaves of a root supernode to the leaves of another.
+ *
+ * @param summary The superdigraph which gives the hierarchy, its edges are not read
+ * @param corrections The corrections encoded against the same hierarchy
+ * @param first The root supernode of the sources
+ * @param second The root supernode of the destinations
+ * @param emit The function called with (src, dst, weight) for each edge
+ *
+ * @note If a supernode does not exist, throw std::out_of_range, and if it is not a root, throw std::invalid_argument.
+ */
+void decompress(const graph_structure::WeightedSuperDigraph &summary, const graph_structure::CorrectionSet &corrections, int first, int second, const std::function<void(int, int, double)> &emit);
+
+} // namespace decompression
+} // namespace anagraph
+
+#endif // DECOMPRESSION_HPP
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+#ifndef LOCAL_CLUSTERING_HPP
+#define LOCAL_CLUSTERING_HPP
+
+#include "anagraph/components/unweighted_graph.hpp"
+#include "anagraph/components/weighted_graph.hpp"
+
+#include <vector>
+
+namespace anagraph {
+namespace local_clustering {
+
+/*
+ * The local clustering of Andersen, Chung and Lang, which finds a cluster of low conductance around a seed node
+ * by a sweep over the approximate personalized PageRank from the seed.
+ * The conductance of a cluster S is cut(S) / min(vol(S), vol(V) - vol(S)),
+ * where vol is the sum of the weighted degrees and cut is the weight of the edges leaving S.
+ * Only the nodes reached by the push are stored, and the cost is proportional to their volume.
+ * The volume of the whole graph is needed only by a prefix of the sweep larger than the touched volume outside of it,
+ * and then it is computed from the whole graph unless it is given, e.g. to repeat the search from many seeds.
+ */
+
+/**
+ * @struct LocalCluster
+ * @brief The cluster found by the sweep.
+ */
+struct LocalCluster {
+    std::vector<int> ids; /**< The ids of the nodes in the cluster, sorted in ascending order */
+    double conductance; /**< The conductance of the cluster, 1.0 if the seed has no edge */
+    double volume; /**< The sum of the weighted degrees of the nodes in the cluster */
+    double cut; /**< The sum of the weights of the edges leaving the cluster */
+};
+
+/**
+ * @brief Find a cluster around a seed node.
+ * @param graph The graph
+ * @param seed The id of the seed node
+ * @return The prefix of the sweep with the smallest conductance
+ *
+ * @note The teleport probability is 0.15 and the push threshold is 1e-4.
+ */
+LocalCluster findCluster(const graph_structure::Graph &graph, int seed);
+
+/**
+ * @brief Find a cluster around a seed node.
+ * @param graph The graph
+ * @param seed The id of the seed node
+ * @param alpha The teleport probability of the personalized PageRank
+ * @param epsilon The push threshold of the residue per unit degree, a smaller one finds a larger cluster
+ * @return The prefix of the sweep with the smallest conductance
+ *
+ * @note The volume of the whole graph is computed in O(n + m) only if a prefix of the sweep needs it.
+ */
+LocalCluster findCluster(const graph_structure::Graph &graph, int seed, double alpha, double epsilon);
+
+/**
+ * @brief Find a cluster around a seed node.
+ *
+ * The residue of the seed is pushed to its neighbors by the lazy random walk while a node has a residue
+ * of at least epsilon times its degree, which touches O(1 / (alpha epsilon)) volume.
+ * Then the nodes are sorted by the PageRank divided by the degree,
+ * and the conductance of each prefix is updated incrementally from the previous one by the edges of the added node.
+ *
+ * @param graph The graph
+ * @param seed The id of the seed node
+ * @param alpha The teleport probability of the personalized PageRank
+ * @param epsilon The push threshold of the residue per unit degree, a smaller one finds a larger cluster
+ * @param totalVolume The volume of the whole graph, i.e. twice the number of the edges
+ * @return The prefix of the sweep with the smallest conductance
+ *
+ * @note If the seed does not exist, throw std::out_of_range, and if alpha is not in (0, 1] or epsilon is not positive,
+ * throw std::invalid_argument.
+ */
+LocalCluster findCluster(const graph_structure::Graph &graph, int seed, double alpha, double epsilon, double totalVolume);
+
+/**
+ * @brief Find a cluster around a seed node.
+ * @param graph The graph with non-negative weights
+ * @param seed The id of the seed node
+ * @return The prefix of the sweep with the smallest conductance
+ *
+ * @note The teleport probability is 0.15 and the push threshold is 1e-4.
+ */
+LocalCluster findCluster(const graph_structure::WeightedGraph &graph, int seed);
+
+/**
+ * @brief Find a cluster around a seed node.
+ * @param graph The graph with non-negative weights
+ * @param seed The id of the seed node
+ * @param alpha The teleport probability of the personalized PageRank
+ * @param epsilon The push threshold of the residue per unit degree, a smaller one finds a larger cluster
+ * @return The prefix of the sweep with the smallest conductance
+ *
+ * @note The volume of the whole graph is computed in O(n + m) only if a prefix of the sweep needs it.
+ */
+LocalCluster findCluster(const graph_structure::WeightedGraph &graph, int seed, double alpha, double epsilon);
+
+/**
+ * @brief Find a cluster around a seed node.
+ * @param graph The graph with non-negative weights
+ * @param seed The id of the seed node
+ * @param alpha The teleport probability of the personalized PageRank
+ * @param epsilon The push threshold of the residue per unit degree, a smaller one finds a larger cluster
+ * @param totalVolume The volume of the whole graph, i.e. the sum of the weighted degrees
+ * @return The prefix of the sweep with the smallest conductance
+ *
+ * @note If the seed does not exist, throw std::out_of_range, and if alpha is not in (0, 1] or epsilon is not positive,
+ * throw std::invalid_argument.
+ */
+LocalCluster findCluster(const graph_structure::WeightedGraph &graph, int seed, double alpha, double epsilon, double totalVolume);
+
+} // namespace local_clustering
+} // namespace anagraph
+
+#endif // LOCAL_CLUSTERING_HPP
\ No newline at end of file
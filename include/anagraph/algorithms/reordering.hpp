@@ -0,0 +1,161 @@
+#pragma once
+
+#ifndef REORDERING_HPP
+#define REORDERING_HPP
+
+#include "anagraph/components/weighted_graph.hpp"
+#include "anagraph/components/unweighted_digraph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+
+#include <unordered_map>
+
+namespace anagraph {
+namespace reordering {
+
+/**
+ * @brief Order the nodes by descending degree.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Ties are broken by the old id.
+ * For directed graphs, the degree is the sum of the in-degree and the out-degree.
+ */
+std::unordered_map<int, int> degreeOrder(const graph_structure::WeightedDigraph &graph);
+
+/**
+ * @brief Order the nodes by descending degree.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Ties are broken by the old id.
+ */
+std::unordered_map<int, int> degreeOrder(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Order the nodes by descending degree.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Ties are broken by the old id.
+ * For directed graphs, the degree is the sum of the in-degree and the out-degree.
+ */
+std::unordered_map<int, int> degreeOrder(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Order the nodes by descending degree.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Ties are broken by the old id.
+ */
+std::unordered_map<int, int> degreeOrder(const graph_structure::Graph &graph);
+
+/**
+ * @brief Order the nodes by the reverse Cuthill-McKee algorithm.
+ *
+ * Each connected component is traversed by BFS from its node of minimum degree,
+ * visiting the adjacent nodes in ascending order of degree, and the whole order is reversed.
+ * This keeps adjacent nodes close to each other, i.e. reduces the bandwidth of the adjacency matrix.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Directed edges are treated as undirected.
+ */
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::WeightedDigraph &graph);
+
+/**
+ * @brief Order the nodes by the reverse Cuthill-McKee algorithm.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential.
+ */
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Order the nodes by the reverse Cuthill-McKee algorithm.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Directed edges are treated as undirected.
+ */
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Order the nodes by the reverse Cuthill-McKee algorithm.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential.
+ */
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::Graph &graph);
+
+/**
+ * @brief Order the nodes so that each community gets a contiguous range of ids.
+ *
+ * The communities are found in the same way as Rabbit Order:
+ * nodes are visited in ascending order of degree, and each node is merged into
+ * the adjacent community with the largest positive modularity gain.
+ * The resulting dendrogram is traversed by DFS to assign the new ids.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Directed edges are treated as undirected.
+ */
+std::unordered_map<int, int> communityOrder(const graph_structure::WeightedDigraph &graph);
+
+/**
+ * @brief Order the nodes so that each community gets a contiguous range of ids.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential.
+ */
+std::unordered_map<int, int> communityOrder(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Order the nodes so that each community gets a contiguous range of ids.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential. Directed edges are treated as undirected.
+ */
+std::unordered_map<int, int> communityOrder(const graph_structure::Digraph &graph);
+
+/**
+ * @brief Order the nodes so that each community gets a contiguous range of ids.
+ *
+ * @param graph The graph to reorder
+ *
+ * @return The map from the old id to the new id, to be passed to relabel()
+ *
+ * @note The new ids are 0-origin and sequential.
+ */
+std::unordered_map<int, int> communityOrder(const graph_structure::Graph &graph);
+
+} // namespace reordering
+} // namespace anagraph
+
+#endif // REORDERING_HPP
\ No newline at end of file
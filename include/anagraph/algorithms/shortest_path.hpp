@@ -0,0 +1,141 @@
+#pragma once
+
+#ifndef SHORTEST_PATH_HPP
+#define SHORTEST_PATH_HPP
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/weighted_digraph.hpp"
+#include "anagraph/components/weighted_graph.hpp"
+
+#include <vector>
+
+namespace anagraph {
+namespace shortest_path {
+
+/**
+ * @brief The parent of a node which is not reached from the source.
+ */
+constexpr int UNREACHED = -1;
+
+/**
+ * @struct ShortestPathResult
+ * @brief The tree of the shortest paths from a source.
+ *
+ * @note Both vectors are indexed by the position of the node in the ascending ids, i.e. the index of CompressedGraph.
+ */
+struct ShortestPathResult {
+    std::vector<double> distances; /**< The length of the shortest path, infinity if the node is not reached */
+    std::vector<int> parents; /**< The id of the previous node on the path, the source for itself, UNREACHED if the node is not reached */
+};
+
+/**
+ * @brief Calculate the shortest paths from a source by Dijkstra's algorithm with a 4-ary heap.
+ *
+ * @param graph The digraph with non-negative weights
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note If the source does not exist, throw std::out_of_range, and if a weight is negative, throw std::invalid_argument.
+ */
+ShortestPathResult dijkstra(const graph_structure::WeightedDigraph &graph, int source);
+
+/**
+ * @brief Calculate the shortest paths from a source by Dijkstra's algorithm with a 4-ary heap.
+ *
+ * @param graph The graph with non-negative weights
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note If the source does not exist, throw std::out_of_range, and if a weight is negative, throw std::invalid_argument.
+ */
+ShortestPathResult dijkstra(const graph_structure::WeightedGraph &graph, int source);
+
+/**
+ * @brief Calculate the shortest paths from a source by Dijkstra's algorithm with a 4-ary heap.
+ *
+ * @param graph The compressed graph with non-negative weights
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note The heap is indexed by the node, so that each node is in it at most once. It suits small graphs,
+ * the cost is O(m log n) on a single thread.
+ * If the source does not exist, throw std::out_of_range, and if a weight is negative, throw std::invalid_argument.
+ */
+ShortestPathResult dijkstra(const graph_structure::CompressedGraph &graph, int source);
+
+/**
+ * @brief Calculate the shortest paths from a source by delta-stepping.
+ *
+ * @param graph The digraph with non-negative weights
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note The bucket width is the mean weight, and the search runs on 1 thread.
+ */
+ShortestPathResult deltaStepping(const graph_structure::WeightedDigraph &graph, int source);
+
+/**
+ * @brief Calculate the shortest paths from a source by delta-stepping.
+ *
+ * @param graph The digraph with non-negative weights
+ * @param source The id of the source node
+ * @param delta The width of each bucket of the distances
+ * @param numThreads The number of threads to relax the edges
+ *
+ * @return The distances and the parents of the nodes
+ */
+ShortestPathResult deltaStepping(const graph_structure::WeightedDigraph &graph, int source, double delta, int numThreads);
+
+/**
+ * @brief Calculate the shortest paths from a source by delta-stepping.
+ *
+ * @param graph The graph with non-negative weights
+ * @param source The id of the source node
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note The bucket width is the mean weight, and the search runs on 1 thread.
+ */
+ShortestPathResult deltaStepping(const graph_structure::WeightedGraph &graph, int source);
+
+/**
+ * @brief Calculate the shortest paths from a source by delta-stepping.
+ *
+ * @param graph The graph with non-negative weights
+ * @param source The id of the source node
+ * @param delta The width of each bucket of the distances
+ * @param numThreads The number of threads to relax the edges
+ *
+ * @return The distances and the parents of the nodes
+ */
+ShortestPathResult deltaStepping(const graph_structure::WeightedGraph &graph, int source, double delta, int numThreads);
+
+/**
+ * @brief Calculate the shortest paths from a source by delta-stepping.
+ *
+ * The nodes are kept in buckets of the distances of width delta, where only the non-empty buckets are stored.
+ * The smallest non-empty bucket is taken as the frontier, and the out-edges of the frontier are relaxed in parallel,
+ * until no node is left in the bucket. Then the next non-empty bucket is processed.
+ *
+ * @param graph The compressed graph with non-negative weights
+ * @param source The id of the source node
+ * @param delta The width of each bucket of the distances
+ * @param numThreads The number of threads to relax the edges
+ *
+ * @return The distances and the parents of the nodes
+ *
+ * @note A smaller delta relaxes fewer edges again, and a larger delta gives more parallelism to each bucket.
+ * The distances do not depend on the number of threads, but the parent among the paths of the same length may.
+ * If the source does not exist, throw std::out_of_range, and if a weight is negative, delta is not positive,
+ * or the maximum weight times n - 1 exceeds 2^62 times delta, throw std::invalid_argument.
+ */
+ShortestPathResult deltaStepping(const graph_structure::CompressedGraph &graph, int source, double delta, int numThreads);
+
+} // namespace shortest_path
+} // namespace anagraph
+
+#endif // SHORTEST_PATH_HPP
\ No newline at end of file
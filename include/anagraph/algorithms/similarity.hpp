@@ -5,7 +5,10 @@
 
 #include "anagraph/components/unweighted_digraph.hpp"
 #include "anagraph/components/unweighted_graph.hpp"
+#include "anagraph/components/weighted_graph.hpp"
 
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace anagraph {
@@ -30,6 +33,7 @@ namespace similarity {
      * @return The nDCG value.
      * 
      * @note The vectors must have the same size. The value of k must be less than or equal to the size of the vectors.
+     * Ties are broken by the smaller index.
      */
     double nDCG(const std::vector<double>& expected, const std::vector<double>& answer, int k);
 
@@ -46,6 +50,82 @@ namespace similarity {
      */
     double nDCG(const std::vector<double>& expected, const std::vector<double>& answer);
 
+    /*
+     * The precision@k and the recall@k share the relevant elements of expected, the elements whose values are larger
+     * than a threshold. The precision@k also accepts the top-k elements of expected as the relevant ones,
+     * for which the recall@k would be the same overlap divided by k, so the recall@k always takes a threshold.
+     */
+
+    /**
+     * Calculates the precision@k, the fraction of the top-k elements of answer which are relevant.
+     *
+     * @param expected The vector of expected values, whose top-k elements are relevant.
+     * @param answer The vector of answer values.
+     * @param k The number of top elements to compare.
+     * @return The fraction of the top-k elements of answer which are also in the top-k elements of expected.
+     *
+     * @note The vectors must have the same size. The value of k must be in [1, size].
+     * Ties are broken by the smaller index.
+     */
+    double precisionAtK(const std::vector<double>& expected, const std::vector<double>& answer, int k);
+
+    /**
+     * Calculates the precision@k, the fraction of the top-k elements of answer which are relevant.
+     *
+     * @param expected The vector of expected values, whose elements larger than threshold are relevant.
+     * @param answer The vector of answer values.
+     * @param k The number of top elements of answer to consider.
+     * @param threshold The value of expected above which an element is relevant.
+     * @return The fraction of the top-k elements of answer which are relevant.
+     *
+     * @note The vectors must have the same size. The value of k must be in [1, size].
+     * Ties are broken by the smaller index.
+     */
+    double precisionAtK(const std::vector<double>& expected, const std::vector<double>& answer, int k, double threshold);
+
+    /**
+     * Calculates the recall@k, the fraction of the relevant elements found in the top-k elements of answer.
+     *
+     * @param expected The vector of expected values, whose elements larger than threshold are relevant.
+     * @param answer The vector of answer values.
+     * @param k The number of top elements of answer to consider.
+     * @param threshold The value of expected above which an element is relevant.
+     * @return The fraction of the relevant elements in the top-k elements of answer, or 0.0 if no element is relevant.
+     *
+     * @note The vectors must have the same size. The value of k must be in [1, size].
+     * Ties are broken by the smaller index.
+     */
+    double recallAtK(const std::vector<double>& expected, const std::vector<double>& answer, int k, double threshold);
+
+    /**
+     * Calculates the Kendall rank correlation (tau-b) on the top-k elements.
+     *
+     * The elements in the top-k of either expected or answer are ranked by both vectors.
+     *
+     * @param expected The vector of expected values.
+     * @param answer The vector of answer values.
+     * @param k The number of top elements to consider.
+     * @return The Kendall tau in [-1, 1], or 0.0 if either ranking is constant.
+     *
+     * @note The vectors must have the same size. The value of k must be in [1, size].
+     */
+    double kendallTau(const std::vector<double>& expected, const std::vector<double>& answer, int k);
+
+    /**
+     * Calculates the Spearman rank correlation on the top-k elements.
+     *
+     * The elements in the top-k of either expected or answer are ranked by both vectors,
+     * tied values get the average of their ranks.
+     *
+     * @param expected The vector of expected values.
+     * @param answer The vector of answer values.
+     * @param k The number of top elements to consider.
+     * @return The Spearman correlation in [-1, 1], or 0.0 if either ranking is constant.
+     *
+     * @note The vectors must have the same size. The value of k must be in [1, size].
+     */
+    double spearman(const std::vector<double>& expected, const std::vector<double>& answer, int k);
+
     /**
      * Calculates the Kullback-Leibler divergence between two vectors.
      *
@@ -64,6 +144,211 @@ namespace similarity {
      */
     double JSdivergence(const std::vector<double>& p, const std::vector<double>& q);
 
+    /**
+     * Calculates the cosine similarity between every pair of vectors.
+     *
+     * @param vectors The vectors of the same size.
+     * @return The symmetric matrix whose (i, j) element is the cosine similarity between vectors[i] and vectors[j].
+     *
+     * @note The norms are computed once per vector, and the pairs are computed in tiles which fit in the cache.
+     */
+    std::vector<std::vector<double>> cosineSimilarityMatrix(const std::vector<std::vector<double>>& vectors);
+
+    /**
+     * Calculates the cosine similarity between every pair of vectors.
+     *
+     * @param vectors The vectors of the same size.
+     * @param numThreads The number of threads to compute the tiles.
+     * @return The symmetric matrix whose (i, j) element is the cosine similarity between vectors[i] and vectors[j].
+     *
+     * @note The norms are computed once per vector, and the pairs are computed in tiles which fit in the cache.
+     */
+    std::vector<std::vector<double>> cosineSimilarityMatrix(const std::vector<std::vector<double>>& vectors, int numThreads);
+
+    /**
+     * Calculates the Jensen-Shannon divergence between every pair of vectors.
+     *
+     * @param vectors The vectors of the same size.
+     * @return The symmetric matrix whose (i, j) element is the Jensen-Shannon divergence between vectors[i] and vectors[j].
+     */
+    std::vector<std::vector<double>> JSdivergenceMatrix(const std::vector<std::vector<double>>& vectors);
+
+    /**
+     * Calculates the Jensen-Shannon divergence between every pair of vectors.
+     *
+     * @param vectors The vectors of the same size.
+     * @param numThreads The number of threads to compute the tiles.
+     * @return The symmetric matrix whose (i, j) element is the Jensen-Shannon divergence between vectors[i] and vectors[j].
+     */
+    std::vector<std::vector<double>> JSdivergenceMatrix(const std::vector<std::vector<double>>& vectors, int numThreads);
+
+    /**
+     * Finds the k most similar vectors of every vector by the cosine similarity.
+     *
+     * @param vectors The vectors of the same size.
+     * @param k The number of similar vectors to find for each vector.
+     * @return The pairs of the index and the cosine similarity for each vector, in descending order of the similarity.
+     *
+     * @note The vector itself is excluded. Ties are broken by the smaller index.
+     * The value of k must be in [1, size - 1].
+     */
+    std::vector<std::vector<std::pair<int, double>>> topKCosineSimilarity(const std::vector<std::vector<double>>& vectors, int k);
+
+    /**
+     * Finds the k most similar vectors of every vector by the cosine similarity.
+     *
+     * @param vectors The vectors of the same size.
+     * @param k The number of similar vectors to find for each vector.
+     * @param numThreads The number of threads to compute the rows.
+     * @return The pairs of the index and the cosine similarity for each vector, in descending order of the similarity.
+     *
+     * @note The vector itself is excluded. Ties are broken by the smaller index.
+     * The value of k must be in [1, size - 1].
+     */
+    std::vector<std::vector<std::pair<int, double>>> topKCosineSimilarity(const std::vector<std::vector<double>>& vectors, int k, int numThreads);
+
+    /**
+     * Finds the k most similar vectors of every vector by the Jensen-Shannon divergence.
+     *
+     * @param vectors The vectors of the same size.
+     * @param k The number of similar vectors to find for each vector.
+     * @return The pairs of the index and the Jensen-Shannon divergence for each vector, in ascending order of the divergence.
+     *
+     * @note The vector itself is excluded. Ties are broken by the smaller index.
+     * The value of k must be in [1, size - 1].
+     */
+    std::vector<std::vector<std::pair<int, double>>> topKJSdivergence(const std::vector<std::vector<double>>& vectors, int k);
+
+    /**
+     * Finds the k most similar vectors of every vector by the Jensen-Shannon divergence.
+     *
+     * @param vectors The vectors of the same size.
+     * @param k The number of similar vectors to find for each vector.
+     * @param numThreads The number of threads to compute the rows.
+     * @return The pairs of the index and the Jensen-Shannon divergence for each vector, in ascending order of the divergence.
+     *
+     * @note The vector itself is excluded. Ties are broken by the smaller index.
+     * The value of k must be in [1, size - 1].
+     */
+    std::vector<std::vector<std::pair<int, double>>> topKJSdivergence(const std::vector<std::vector<double>>& vectors, int k, int numThreads);
+
+    /**
+     * The result of comparing an answer graph with the expected graph.
+     *
+     * The pairs of distinct nodes of the expected graph are counted, once per unordered pair for undirected graphs.
+     * A pair is positive if the expected graph has the edge, and true if the answer graph has the edge,
+     * so falsePositive counts the edges only the expected graph has and falseNegative the edges only the answer graph has.
+     * A missing edge has the weight 0.0 in the weight errors.
+     */
+    struct GraphComparison {
+        int64_t truePositive; /**< The number of edges both graphs have */
+        int64_t falsePositive; /**< The number of edges only the expected graph has */
+        int64_t falseNegative; /**< The number of edges only the answer graph has */
+        int64_t trueNegative; /**< The number of pairs neither graph has an edge */
+        double accuracy; /**< (tp + tn) / (tp + fp + fn + tn) */
+        double precision; /**< tp / (tp + fp) */
+        double recall; /**< tp / (tp + fn) */
+        double fMeasure; /**< The harmonic mean of precision and recall */
+        double l1Error; /**< The sum of the absolute differences of the weights */
+        double l2Error; /**< The square root of the sum of the squared differences of the weights */
+    };
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected WeightedDigraph.
+     * @param answer The answer WeightedDigraph to be evaluated.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     */
+    GraphComparison compareGraphs(const graph_structure::WeightedDigraph &expected, const graph_structure::WeightedDigraph &answer);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected WeightedDigraph.
+     * @param answer The answer WeightedDigraph to be evaluated.
+     * @param numThreads The number of threads to count the nodes.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     */
+    GraphComparison compareGraphs(const graph_structure::WeightedDigraph &expected, const graph_structure::WeightedDigraph &answer, int numThreads);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected WeightedGraph.
+     * @param answer The answer WeightedGraph to be evaluated.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     */
+    GraphComparison compareGraphs(const graph_structure::WeightedGraph &expected, const graph_structure::WeightedGraph &answer);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected WeightedGraph.
+     * @param answer The answer WeightedGraph to be evaluated.
+     * @param numThreads The number of threads to count the nodes.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     */
+    GraphComparison compareGraphs(const graph_structure::WeightedGraph &expected, const graph_structure::WeightedGraph &answer, int numThreads);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected Digraph.
+     * @param answer The answer Digraph to be evaluated.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     * The weight of every edge is regarded as 1.0.
+     */
+    GraphComparison compareGraphs(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected Digraph.
+     * @param answer The answer Digraph to be evaluated.
+     * @param numThreads The number of threads to count the nodes.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     * The weight of every edge is regarded as 1.0.
+     */
+    GraphComparison compareGraphs(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer, int numThreads);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected Graph.
+     * @param answer The answer Graph to be evaluated.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     * The weight of every edge is regarded as 1.0.
+     */
+    GraphComparison compareGraphs(const graph_structure::Graph &expected, const graph_structure::Graph &answer);
+
+    /**
+     * Compares the answer with the expected result, computing every metric in a single pass.
+     *
+     * @param expected The expected Graph.
+     * @param answer The answer Graph to be evaluated.
+     * @param numThreads The number of threads to count the nodes.
+     * @return The confusion matrix, the metrics and the weight errors.
+     *
+     * @note The answer must contain every node of the expected.
+     * The weight of every edge is regarded as 1.0.
+     */
+    GraphComparison compareGraphs(const graph_structure::Graph &expected, const graph_structure::Graph &answer, int numThreads);
+
     /**
      * Calculates the accuracy of a given answer compared to the expected result.
      *
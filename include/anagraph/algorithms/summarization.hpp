@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef SUMMARIZATION_HPP
+#define SUMMARIZATION_HPP
+
+#include "anagraph/components/weighted_graph.hpp"
+#include "anagraph/components/weighted_supergraph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+
+namespace anagraph {
+namespace summarization {
+
+/**
+ * @brief Summarize a graph by greedily merging the nodes with similar neighbors (SWeG).
+ *
+ * Each iteration groups the current supernodes by the min-hash shingle of their neighbors,
+ * and within each group repeatedly merges a random supernode with its most similar one
+ * while the saving 1 - cost(A + B) / (cost(A) + cost(B)) exceeds the threshold 1 / (1 + t).
+ * The cost of a supernode counts, for each adjacent supernode, the cheaper of encoding the edges between them
+ * as a superedge with corrections or as the edges themselves.
+ *
+ * @param graph The graph to summarize
+ *
+ * @return The supergraph whose leaves are the nodes and edges of the graph,
+ * and whose root supernodes are the summary with the summed edge weights between them
+ *
+ * @note The groups are merged on 1 thread for 20 iterations. The result is deterministic.
+ */
+graph_structure::WeightedSupergraph summarize(const graph_structure::Graph &graph);
+
+/**
+ * @brief Summarize a graph by greedily merging the nodes with similar neighbors (SWeG).
+ *
+ * @param graph The graph to summarize
+ * @param iterations The number of iterations, each of which adds at most one level to the hierarchy
+ *
+ * @return The supergraph whose leaves are the nodes and edges of the graph,
+ * and whose root supernodes are the summary with the summed edge weights between them
+ */
+graph_structure::WeightedSupergraph summarize(const graph_structure::Graph &graph, int iterations);
+
+/**
+ * @brief Summarize a graph by greedily merging the nodes with similar neighbors (SWeG).
+ *
+ * @param graph The graph to summarize
+ * @param iterations The number of iterations, each of which adds at most one level to the hierarchy
+ * @param numThreads The number of threads to merge the groups
+ *
+ * @return The supergraph whose leaves are the nodes and edges of the graph,
+ * and whose root supernodes are the summary with the summed edge weights between them
+ *
+ * @note The groups are merged in parallel against the supernodes at the start of the iteration,
+ * so the result does not depend on the number of threads.
+ */
+graph_structure::WeightedSupergraph summarize(const graph_structure::Graph &graph, int iterations, int numThreads);
+
+/**
+ * @brief Summarize a graph by greedily merging the nodes with similar neighbors (SWeG).
+ *
+ * @param graph The graph to summarize
+ *
+ * @return The supergraph whose leaves are the nodes and edges of the graph,
+ * and whose root supernodes are the summary with the summed edge weights between them
+ *
+ * @note The merges are decided by the structure of the graph, the weights are only summed.
+ */
+graph_structure::WeightedSupergraph summarize(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Summarize a graph by greedily merging the nodes with similar neighbors (SWeG).
+ *
+ * @param graph The graph to summarize
+ * @param iterations The number of iterations, each of which adds at most one level to the hierarchy
+ *
+ * @return The supergraph whose leaves are the nodes and edges of the graph,
+ * and whose root supernodes are the summary with the summed edge weights between them
+ *
+ * @note The merges are decided by the structure of the graph, the weights are only summed.
+ */
+graph_structure::WeightedSupergraph summarize(const graph_structure::WeightedGraph &graph, int iterations);
+
+/**
+ * @brief Summarize a graph by greedily merging the nodes with similar neighbors (SWeG).
+ *
+ * @param graph The graph to summarize
+ * @param iterations The number of iterations, each of which adds at most one level to the hierarchy
+ * @param numThreads The number of threads to merge the groups
+ *
+ * @return The supergraph whose leaves are the nodes and edges of the graph,
+ * and whose root supernodes are the summary with the summed edge weights between them
+ *
+ * @note The merges are decided by the structure of the graph, the weights are only summed.
+ */
+graph_structure::WeightedSupergraph summarize(const graph_structure::WeightedGraph &graph, int iterations, int numThreads);
+
+} // namespace summarization
+} // namespace anagraph
+
+#endif // SUMMARIZATION_HPP
\ No newline at end of file
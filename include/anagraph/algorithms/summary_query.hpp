@@ -0,0 +1,135 @@
+#pragma once
+
+#ifndef SUMMARY_QUERY_HPP
+#define SUMMARY_QUERY_HPP
+
+#include "anagraph/components/weighted_directed_supergraph.hpp"
+#include "anagraph/components/weighted_supergraph.hpp"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace anagraph {
+namespace summary_query {
+
+/*
+ * The queries on the summary of a supergraph, i.e. the root supernodes and the superedges between them,
+ * as produced by summarization::summarize or mergeNodes.
+ * The edges inside a superedge are regarded as spread uniformly over the pairs of its leaves,
+ * so the queries cost in proportion to the part of the summary they visit, not to the original graph.
+ */
+
+/**
+ * @brief Calculate the forward push algorithm for PageRank on the root supernodes.
+ *
+ * @param graph The supergraph
+ * @param source The map from a node to its initial score, each node is regarded as its root supernode
+ * @param alpha The damping factor
+ * @param thr The convergence threshold of the residue
+ *
+ * @return The map from each visited root supernode to its PageRank mass
+ *
+ * @note Only the supernodes reached from the source are visited. Use expand() to estimate the scores of the leaves.
+ */
+std::unordered_map<int, double> forwardPush(const graph_structure::WeightedSuperDigraph &graph, const std::unordered_map<int, double> &source, const double alpha, const double thr);
+
+/**
+ * @brief Calculate the forward push algorithm for PageRank on the root supernodes.
+ *
+ * @param graph The supergraph
+ * @param source The map from a node to its initial score, each node is regarded as its root supernode
+ * @param alpha The damping factor
+ * @param thr The convergence threshold of the residue
+ *
+ * @return The map from each visited root supernode to its PageRank mass
+ *
+ * @note Only the supernodes reached from the source are visited. Use expand() to estimate the scores of the leaves.
+ * The self loop of a supernode counts twice, as each edge between its leaves adds to the degrees of both of them.
+ */
+std::unordered_map<int, double> forwardPush(const graph_structure::WeightedSupergraph &graph, const std::unordered_map<int, double> &source, const double alpha, const double thr);
+
+/**
+ * @brief Estimate the scores of the leaves of a supernode by spreading its score uniformly.
+ *
+ * @param graph The supergraph
+ * @param scores The map from the supernode to its score, e.g. the result of forwardPush
+ * @param supernode The supernode to expand
+ *
+ * @return The map from each leaf of the supernode to its estimated score
+ *
+ * @note If the supernode does not exist, throw an exception.
+ */
+std::unordered_map<int, double> expand(const graph_structure::WeightedSuperDigraph &graph, const std::unordered_map<int, double> &scores, int supernode);
+
+/**
+ * @brief Estimate the scores of the leaves of a supernode by spreading its score uniformly.
+ *
+ * @param graph The supergraph
+ * @param scores The map from the supernode to its score, e.g. the result of forwardPush
+ * @param supernode The supernode to expand
+ *
+ * @return The map from each leaf of the supernode to its estimated score
+ *
+ * @note If the supernode does not exist, throw an exception.
+ */
+std::unordered_map<int, double> expand(const graph_structure::WeightedSupergraph &graph, const std::unordered_map<int, double> &scores, int supernode);
+
+/**
+ * @brief Get the root supernodes adjacent to the root supernode of a node.
+ *
+ * @param graph The supergraph
+ * @param id The node to query
+ *
+ * @return The pairs of the adjacent root supernode and the density of the superedge,
+ * i.e. its weight divided by the number of pairs of their leaves, in ascending order of the supernode
+ *
+ * @note If the node does not exist, throw an exception.
+ */
+std::vector<std::pair<int, double>> getSupernodeNeighbors(const graph_structure::WeightedSuperDigraph &graph, int id);
+
+/**
+ * @brief Get the root supernodes adjacent to the root supernode of a node.
+ *
+ * @param graph The supergraph
+ * @param id The node to query
+ *
+ * @return The pairs of the adjacent root supernode and the density of the superedge,
+ * i.e. its weight divided by the number of pairs of their leaves, in ascending order of the supernode
+ *
+ * @note If the node does not exist, throw an exception.
+ */
+std::vector<std::pair<int, double>> getSupernodeNeighbors(const graph_structure::WeightedSupergraph &graph, int id);
+
+/**
+ * @brief Estimate the neighbors of a node from the summary.
+ *
+ * @param graph The supergraph
+ * @param id The node to query
+ * @param minDensity The minimum density of the superedges to expand
+ *
+ * @return The leaves of the adjacent root supernodes whose superedge is dense enough, in ascending order
+ *
+ * @note Only the selected supernodes are expanded to their leaves. The node itself is excluded.
+ * If the node does not exist, throw an exception.
+ */
+std::vector<int> getNeighbors(const graph_structure::WeightedSuperDigraph &graph, int id, double minDensity);
+
+/**
+ * @brief Estimate the neighbors of a node from the summary.
+ *
+ * @param graph The supergraph
+ * @param id The node to query
+ * @param minDensity The minimum density of the superedges to expand
+ *
+ * @return The leaves of the adjacent root supernodes whose superedge is dense enough, in ascending order
+ *
+ * @note Only the selected supernodes are expanded to their leaves. The node itself is excluded.
+ * If the node does not exist, throw an exception.
+ */
+std::vector<int> getNeighbors(const graph_structure::WeightedSupergraph &graph, int id, double minDensity);
+
+} // namespace summary_query
+} // namespace anagraph
+
+#endif // SUMMARY_QUERY_HPP
\ No newline at end of file
@@ -0,0 +1,224 @@
+#pragma once
+
+#ifndef TRIANGLES_HPP
+#define TRIANGLES_HPP
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+#include "anagraph/components/weighted_graph.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace anagraph {
+namespace triangles {
+
+/*
+ * The triangles of an undirected graph, i.e. the sets of 3 nodes connected with each other.
+ * The weights and the self-loops are ignored, and the degree of a node is the number of its other neighbors.
+ * The vectors are indexed by the position of the node in the ascending ids, i.e. the index of CompressedGraph.
+ */
+
+/**
+ * @brief Count the triangles of a graph.
+ * @param graph The graph
+ * @return The number of the triangles
+ */
+size_t countTriangles(const graph_structure::Graph &graph);
+
+/**
+ * @brief Count the triangles of a graph.
+ * @param graph The graph
+ * @param numThreads The number of threads to intersect the neighbors
+ * @return The number of the triangles
+ */
+size_t countTriangles(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Count the triangles of a graph.
+ * @param graph The graph
+ * @return The number of the triangles
+ */
+size_t countTriangles(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Count the triangles of a graph.
+ * @param graph The graph
+ * @param numThreads The number of threads to intersect the neighbors
+ * @return The number of the triangles
+ */
+size_t countTriangles(const graph_structure::WeightedGraph &graph, int numThreads);
+
+/**
+ * @brief Count the triangles of a compressed graph.
+ *
+ * Each edge is oriented from the node of the smaller degree to the larger one, breaking ties by the index,
+ * so that a node has at most O(sqrt(m)) out-neighbors.
+ * Each triangle is found once at its lowest two nodes, by intersecting their sorted out-neighbors
+ * with kernels::intersectionSize.
+ *
+ * @param graph The compressed graph, storing each edge in both directions
+ * @param numThreads The number of threads to intersect the neighbors
+ * @return The number of the triangles
+ */
+size_t countTriangles(const graph_structure::CompressedGraph &graph, int numThreads);
+
+/**
+ * @brief Count the triangles containing each node of a compressed graph.
+ *
+ * The edges are oriented as countTriangles, and the out-neighbors of each node are marked,
+ * so that the third node of a triangle is found by a lookup instead of an intersection.
+ *
+ * @param graph The compressed graph, storing each edge in both directions
+ * @param numThreads The number of threads to find the triangles
+ * @return The number of the triangles of each node
+ */
+std::vector<size_t> countNodeTriangles(const graph_structure::CompressedGraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the local clustering coefficient of each node.
+ * @param graph The graph
+ * @return The ratio of the connected pairs among the neighbors of each node, 0.0 if the degree is less than 2
+ */
+std::vector<double> clusteringCoefficients(const graph_structure::Graph &graph);
+
+/**
+ * @brief Calculate the local clustering coefficient of each node.
+ * @param graph The graph
+ * @param numThreads The number of threads to find the triangles
+ * @return The ratio of the connected pairs among the neighbors of each node, 0.0 if the degree is less than 2
+ */
+std::vector<double> clusteringCoefficients(const graph_structure::Graph &graph, int numThreads);
+
+/**
+ * @brief Calculate the local clustering coefficient of each node.
+ * @param graph The graph
+ * @return The ratio of the connected pairs among the neighbors of each node, 0.0 if the degree is less than 2
+ *
+ * @note The weights are ignored.
+ */
+std::vector<double> clusteringCoefficients(const graph_structure::WeightedGraph &graph);
+
+/**
+ * @brief Calculate the local clustering coefficient of each node.
+ * @param graph The graph
+ * @param numThreads The number of threads to find the triangles
+ * @return The ratio of the connected pairs among the neighbors of each node, 0.0 if the degree is less than 2
+ *
+ * @note The weights are ignored.
+ */
+std::vector<double> clusteringCoefficients(const graph_structure::WeightedGraph &graph, int numThreads);
+
+/**
+ * @brief Calculate the local clustering coefficient of each node of a compressed graph.
+ * @param graph The compressed graph, storing each edge in both directions
+ * @param numThreads The number of threads to find the triangles
+ * @return The ratio of the connected pairs among the neighbors of each node, 0.0 if the degree is less than 2
+ */
+std::vector<double> clusteringCoefficients(const graph_structure::CompressedGraph &graph, int numThreads);
+
+/**
+ * @brief Estimate the number of the triangles of a graph by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @return The estimated number of the triangles
+ */
+double estimateTriangles(const graph_structure::Graph &graph, size_t samples);
+
+/**
+ * @brief Estimate the number of the triangles of a graph by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @param numThreads The number of threads to sample the wedges
+ * @return The estimated number of the triangles
+ */
+double estimateTriangles(const graph_structure::Graph &graph, size_t samples, int numThreads);
+
+/**
+ * @brief Estimate the number of the triangles of a graph by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @return The estimated number of the triangles
+ */
+double estimateTriangles(const graph_structure::WeightedGraph &graph, size_t samples);
+
+/**
+ * @brief Estimate the number of the triangles of a graph by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @param numThreads The number of threads to sample the wedges
+ * @return The estimated number of the triangles
+ */
+double estimateTriangles(const graph_structure::WeightedGraph &graph, size_t samples, int numThreads);
+
+/**
+ * @brief Estimate the number of the triangles of a compressed graph by sampling wedges.
+ *
+ * A wedge is a path of 2 edges, and a node of degree d is the center of d(d-1)/2 wedges.
+ * The wedges are sampled uniformly, and the ratio of the closed ones, which are a part of a triangle,
+ * times the number of the wedges is 3 times the number of the triangles.
+ *
+ * @param graph The compressed graph, storing each edge in both directions
+ * @param samples The number of the sampled wedges
+ * @param numThreads The number of threads to sample the wedges
+ * @return The estimated number of the triangles
+ *
+ * @note The standard error of the ratio is at most 1 / (2 sqrt(samples)), independent of the size of the graph.
+ * The samples are drawn from fixed seeds, so the result does not depend on the number of threads.
+ * If samples is 0, throw std::invalid_argument.
+ */
+double estimateTriangles(const graph_structure::CompressedGraph &graph, size_t samples, int numThreads);
+
+/**
+ * @brief Estimate the average of the local clustering coefficients by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @return The estimated average clustering coefficient
+ */
+double estimateAverageClustering(const graph_structure::Graph &graph, size_t samples);
+
+/**
+ * @brief Estimate the average of the local clustering coefficients by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @param numThreads The number of threads to sample the wedges
+ * @return The estimated average clustering coefficient
+ */
+double estimateAverageClustering(const graph_structure::Graph &graph, size_t samples, int numThreads);
+
+/**
+ * @brief Estimate the average of the local clustering coefficients by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @return The estimated average clustering coefficient
+ */
+double estimateAverageClustering(const graph_structure::WeightedGraph &graph, size_t samples);
+
+/**
+ * @brief Estimate the average of the local clustering coefficients by sampling wedges.
+ * @param graph The graph
+ * @param samples The number of the sampled wedges
+ * @param numThreads The number of threads to sample the wedges
+ * @return The estimated average clustering coefficient
+ */
+double estimateAverageClustering(const graph_structure::WeightedGraph &graph, size_t samples, int numThreads);
+
+/**
+ * @brief Estimate the average of the local clustering coefficients of a compressed graph by sampling wedges.
+ *
+ * A node is sampled uniformly, and a wedge centered at it is sampled uniformly,
+ * so that the wedge is closed with the probability of its clustering coefficient.
+ *
+ * @param graph The compressed graph, storing each edge in both directions
+ * @param samples The number of the sampled wedges
+ * @param numThreads The number of threads to sample the wedges
+ * @return The estimated average clustering coefficient, where a node of degree less than 2 counts as 0.0
+ *
+ * @note The result does not depend on the number of threads. If samples is 0, throw std::invalid_argument.
+ */
+double estimateAverageClustering(const graph_structure::CompressedGraph &graph, size_t samples, int numThreads);
+
+} // namespace triangles
+} // namespace anagraph
+
+#endif // TRIANGLES_HPP
\ No newline at end of file
@@ -0,0 +1,149 @@
+#pragma once
+
+#ifndef VECTOR_KERNELS_HPP
+#define VECTOR_KERNELS_HPP
+
+#include <cstddef>
+
+namespace anagraph {
+namespace kernels {
+
+/**
+ * @brief The instruction sets of the kernels.
+ */
+enum class SimdLevel {
+    SCALAR,
+    AVX2,
+    AVX512,
+};
+
+/**
+ * @brief The dot product and the squared norms of two vectors.
+ */
+struct DotProducts {
+    double dot;
+    double squaredNorm1;
+    double squaredNorm2;
+};
+
+/**
+ * @brief Get the widest instruction set supported by both the running CPU and the build.
+ *
+ * @note The result is detected once and cached.
+ */
+SimdLevel getSimdLevel();
+
+/**
+ * @brief Check if an instruction set is supported by both the running CPU and the build.
+ * @param level The instruction set to check
+ */
+bool isSupported(SimdLevel level);
+
+/**
+ * @brief Calculate the dot product of two vectors.
+ * @param v1 The first vector
+ * @param v2 The second vector
+ * @param size The number of elements of both vectors
+ */
+double dot(const double *v1, const double *v2, size_t size);
+
+/**
+ * @brief Calculate the dot product of two vectors.
+ * @param v1 The first vector
+ * @param v2 The second vector
+ * @param size The number of elements of both vectors
+ * @param level The instruction set to use
+ *
+ * @note If the instruction set is not supported, throw an exception.
+ */
+double dot(const double *v1, const double *v2, size_t size, SimdLevel level);
+
+/**
+ * @brief Calculate the dot product and the squared norms of two vectors in a single pass.
+ * @param v1 The first vector
+ * @param v2 The second vector
+ * @param size The number of elements of both vectors
+ */
+DotProducts dotAndNorms(const double *v1, const double *v2, size_t size);
+
+/**
+ * @brief Calculate the dot product and the squared norms of two vectors in a single pass.
+ * @param v1 The first vector
+ * @param v2 The second vector
+ * @param size The number of elements of both vectors
+ * @param level The instruction set to use
+ *
+ * @note If the instruction set is not supported, throw an exception.
+ */
+DotProducts dotAndNorms(const double *v1, const double *v2, size_t size, SimdLevel level);
+
+/**
+ * @brief Calculate the Kullback-Leibler divergence in bits.
+ * @param p The first distribution
+ * @param q The second distribution
+ * @param size The number of elements of both distributions
+ *
+ * @note If q contains 0.0 where p is non-zero, throw an exception.
+ */
+double klDivergence(const double *p, const double *q, size_t size);
+
+/**
+ * @brief Calculate the Kullback-Leibler divergence in bits.
+ * @param p The first distribution
+ * @param q The second distribution
+ * @param size The number of elements of both distributions
+ * @param level The instruction set to use
+ *
+ * @note If q contains 0.0 where p is non-zero, or the instruction set is not supported, throw an exception.
+ */
+double klDivergence(const double *p, const double *q, size_t size, SimdLevel level);
+
+/**
+ * @brief Calculate the Jensen-Shannon divergence in bits.
+ * @param p The first distribution
+ * @param q The second distribution
+ * @param size The number of elements of both distributions
+ *
+ * @note The midpoint distribution is computed on the fly, in the same pass as both divergences.
+ */
+double jsDivergence(const double *p, const double *q, size_t size);
+
+/**
+ * @brief Calculate the Jensen-Shannon divergence in bits.
+ * @param p The first distribution
+ * @param q The second distribution
+ * @param size The number of elements of both distributions
+ * @param level The instruction set to use
+ *
+ * @note If the instruction set is not supported, throw an exception.
+ */
+double jsDivergence(const double *p, const double *q, size_t size, SimdLevel level);
+
+/**
+ * @brief Count the common elements of two sorted arrays, e.g. the common neighbors of two nodes.
+ * @param a The first array
+ * @param sizeA The number of elements of the first array
+ * @param b The second array
+ * @param sizeB The number of elements of the second array
+ *
+ * @note Both arrays must be sorted in ascending order without duplicates.
+ */
+size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB);
+
+/**
+ * @brief Count the common elements of two sorted arrays, e.g. the common neighbors of two nodes.
+ * @param a The first array
+ * @param sizeA The number of elements of the first array
+ * @param b The second array
+ * @param sizeB The number of elements of the second array
+ * @param level The instruction set to use
+ *
+ * @note Both arrays must be sorted in ascending order without duplicates.
+ * If the instruction set is not supported, throw an exception.
+ */
+size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB, SimdLevel level);
+
+} // namespace kernels
+} // namespace anagraph
+
+#endif // VECTOR_KERNELS_HPP
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#ifndef COMPRESSED_GRAPH_HPP
+#define COMPRESSED_GRAPH_HPP
+
+#include "anagraph/components/weighted_graph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace anagraph {
+namespace graph_structure {
+
+/**
+ * @class CompressedGraph
+ * @brief Represents a read-only snapshot of a graph in the compressed sparse row (CSR) format.
+ *
+ * @note The nodes are indexed by their position in the ascending ids of the original graph, 0 to size() - 1.
+ * The adjacent nodes of each node are stored contiguously and sorted by the index,
+ * so that whole-graph passes can scan flat arrays instead of hash tables.
+ * Undirected graphs store each edge in both directions, and unweighted graphs store the weight 1.0.
+ */
+class CompressedGraph {
+private:
+    std::vector<int> ids; /**< The id of the node at each index, in ascending order */
+    std::vector<size_t> offsets; /**< The adjacent nodes of index i are in [offsets[i], offsets[i + 1]) */
+    std::vector<int> targets; /**< The index of the destination of each edge */
+    std::vector<double> weights; /**< The weight of each edge */
+
+public:
+    /**
+     * @brief Constructs an empty CompressedGraph object.
+     */
+    CompressedGraph() : offsets(1, 0) {}
+
+    /**
+     * @brief Constructs a CompressedGraph object from a graph.
+     * @param graph The graph to compress
+     */
+    explicit CompressedGraph(const WeightedDigraph &graph);
+
+    /**
+     * @brief Constructs a CompressedGraph object from a graph.
+     * @param graph The graph to compress
+     */
+    explicit CompressedGraph(const WeightedGraph &graph);
+
+    /**
+     * @brief Constructs a CompressedGraph object from a graph.
+     * @param graph The graph to compress
+     */
+    explicit CompressedGraph(const Digraph &graph);
+
+    /**
+     * @brief Constructs a CompressedGraph object from a graph.
+     * @param graph The graph to compress
+     */
+    explicit CompressedGraph(const Graph &graph);
+
+    /**
+     * @brief Get the number of nodes in the graph.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the number of directed edges in the graph.
+     */
+    size_t edgeSize() const;
+
+    /**
+     * @brief Get the id of a node in the original graph.
+     * @param index The index of the node
+     */
+    int getId(int index) const;
+
+    /**
+     * @brief Get the index of a node.
+     * @param id The id of the node in the original graph
+     *
+     * @note If the node does not exist, throw an exception.
+     */
+    int getIndex(int id) const;
+
+    /**
+     * @brief Get the ids of all nodes, indexed by the index of the node.
+     */
+    std::span<const int> getIds() const;
+
+    /**
+     * @brief Get the offsets of the adjacent nodes of all nodes.
+     * @return The array of size() + 1 elements
+     */
+    std::span<const size_t> getOffsets() const;
+
+    /**
+     * @brief Get the destinations of all edges.
+     * @return The array of edgeSize() elements, grouped by the source node
+     */
+    std::span<const int> getTargets() const;
+
+    /**
+     * @brief Get the weights of all edges.
+     * @return The array of edgeSize() elements, parallel to getTargets()
+     */
+    std::span<const double> getWeights() const;
+
+    /**
+     * @brief Get the adjacent nodes of a node.
+     * @param index The index of the source node
+     * @return The indices of the adjacent nodes in ascending order
+     */
+    std::span<const int> getAdjacents(int index) const;
+
+    /**
+     * @brief Get the weights of the edges from a node.
+     * @param index The index of the source node
+     * @return The weights parallel to getAdjacents(index)
+     */
+    std::span<const double> getWeights(int index) const;
+
+    /**
+     * @brief Get the out-degree of a node.
+     * @param index The index of the node
+     */
+    size_t getDegree(int index) const;
+
+    /**
+     * @brief Get the graph with every edge reversed.
+     * @return The transposed graph sharing the same indices
+     */
+    CompressedGraph transpose() const;
+};
+
+} // namespace graph_structure
+} // namespace anagraph
+
+#endif // COMPRESSED_GRAPH_HPP
\ No newline at end of file
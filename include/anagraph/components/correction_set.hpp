@@ -0,0 +1,160 @@
+#pragma once
+
+#ifndef CORRECTION_SET_HPP
+#define CORRECTION_SET_HPP
+
+#include "anagraph/components/hierarchy_index.hpp"
+#include "anagraph/utils/graph_utils.hpp"
+
+#include <cstddef>
+#include <map>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace anagraph {
+namespace graph_structure {
+
+/**
+ * @class CorrectionSet
+ * @brief Represents the corrections which make a summary of a graph lossless.
+ *
+ * A superedge between two root supernodes implies an edge between every pair of their leaves with the same weight.
+ * The removals (C-) are the implied pairs which are not edges of the original graph,
+ * and the additions (C+) are the edges which are not implied, or whose weight differs from the implied one.
+ * The corrections are grouped by the pair of root supernodes, so that each pair can be decompressed on its own.
+ *
+ * @note For an undirected graph, each supernode pair and each edge is stored once with the smaller id first.
+ */
+class CorrectionSet {
+private:
+    using SupernodePair = std::pair<int, int>;
+
+    bool isOrdered; /**< Whether the pairs are ordered, i.e. the summarized graph is directed */
+    std::map<SupernodePair, double> superedges; /**< The weight implied for every pair of leaves */
+    std::map<SupernodePair, std::vector<WeightedEdgeObject>> additions; /**< C+, sorted by (src, dst) */
+    std::map<SupernodePair, std::vector<EdgeObject>> removals; /**< C-, sorted by (src, dst) */
+
+public:
+    /**
+     * @brief Constructs an empty CorrectionSet object of an undirected graph.
+     */
+    CorrectionSet();
+
+    /**
+     * @brief Constructs an empty CorrectionSet object.
+     * @param isDirected Whether the summarized graph is directed
+     */
+    explicit CorrectionSet(bool isDirected);
+
+    /**
+     * @brief Check if the summarized graph is directed.
+     */
+    bool isDirected() const;
+
+    /**
+     * @brief Set a superedge which implies an edge between every pair of the leaves.
+     * @param first The first root supernode
+     * @param second The second root supernode
+     * @param weight The weight of the implied edges
+     */
+    void setSuperedge(int first, int second, double weight);
+
+    /**
+     * @brief Check if a superedge exists.
+     * @param first The first root supernode
+     * @param second The second root supernode
+     */
+    bool hasSuperedge(int first, int second) const;
+
+    /**
+     * @brief Get the weight implied by a superedge.
+     * @param first The first root supernode
+     * @param second The second root supernode
+     *
+     * @note If the superedge does not exist, throw an exception.
+     */
+    double getSuperedgeWeight(int first, int second) const;
+
+    /**
+     * @brief Add an edge which is not implied by the superedge, or whose weight differs from the implied one (C+).
+     * @param first The root supernode of src
+     * @param second The root supernode of dst
+     * @param src The source leaf
+     * @param dst The destination leaf
+     * @param weight The weight of the edge
+     *
+     * @note If the edge has already been added, its weight is overwritten.
+     */
+    void addAddition(int first, int second, int src, int dst, double weight);
+
+    /**
+     * @brief Add a pair of leaves which is implied by the superedge but is not an edge (C-).
+     * @param first The root supernode of src
+     * @param second The root supernode of dst
+     * @param src The source leaf
+     * @param dst The destination leaf
+     */
+    void addRemoval(int first, int second, int src, int dst);
+
+    /**
+     * @brief Get the additions between two root supernodes without copying them.
+     * @param first The first root supernode
+     * @param second The second root supernode
+     * @return The edges in ascending order of (src, dst), empty if there is none
+     */
+    std::span<const WeightedEdgeObject> getAdditions(int first, int second) const;
+
+    /**
+     * @brief Get the removals between two root supernodes without copying them.
+     * @param first The first root supernode
+     * @param second The second root supernode
+     * @return The pairs of leaves in ascending order of (src, dst), empty if there is none
+     */
+    std::span<const EdgeObject> getRemovals(int first, int second) const;
+
+    /**
+     * @brief Get all the pairs of root supernodes which have a superedge or an addition.
+     * @return The pairs in ascending order
+     */
+    std::vector<std::pair<int, int>> getSupernodePairs() const;
+
+    /**
+     * @brief Get the number of the superedges.
+     */
+    size_t getSuperedgeCount() const;
+
+    /**
+     * @brief Get the number of the additions and the removals.
+     */
+    size_t getCorrectionCount() const;
+
+    /**
+     * @brief Read the corrections from files.
+     * @param filePath The name of the folder that contains the superedges.*, additions.* and removals.*
+     * @param extName The extension of the file
+     * @param hierarchy The hierarchy of the summary, to group the corrections by the root supernodes
+     */
+    void readCorrections(std::string filePath, FileExtension extName, const HierarchyIndex &hierarchy);
+
+    /**
+     * @brief Write the corrections to files.
+     * @param filePath The name of the folder to export the corrections to
+     * @param extName The extension of the file
+     *
+     * @note The corrections will be exported as superedges.*, additions.* and removals.* in the folder.
+     */
+    void writeCorrections(std::string filePath, FileExtension extName) const;
+
+private:
+    /**
+     * @brief Order a pair, if the graph is undirected.
+     */
+    std::pair<int, int> normalize(int first, int second) const;
+};
+
+} // namespace graph_structure
+} // namespace anagraph
+
+#endif // CORRECTION_SET_HPP
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+
+#ifndef HIERARCHY_INDEX_HPP
+#define HIERARCHY_INDEX_HPP
+
+#include "anagraph/components/weighted_supernode.hpp"
+
+#include <cstddef>
+#include <map>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace anagraph {
+namespace graph_structure {
+
+/**
+ * @class HierarchyIndex
+ * @brief Represents the parent-child forest of supernodes flattened by an Euler tour.
+ *
+ * @note Each tree is laid out contiguously: a node is entered and exited once,
+ * so the descendants of a node are exactly the nodes entered within its interval,
+ * and its leaves are a contiguous range of the leaf array.
+ * Trees which change are laid out again at the end of the arrays, and the whole forest is compacted
+ * when the stale part becomes larger than the live part.
+ */
+class HierarchyIndex {
+private:
+    struct Entry {
+        int enter; /**< The position where the node is entered */
+        int exit; /**< The position after all the descendants are entered */
+        int depth; /**< The number of ancestors */
+        int root; /**< The root of the tree the node was laid out in */
+        size_t leafBegin; /**< The leaves of the node are in [leafBegin, leafEnd) of leaves */
+        size_t leafEnd;
+        std::vector<int> jumps; /**< The 2^k-th ancestor for each k, to find the LCA */
+    };
+
+    std::unordered_map<int, Entry> entries; /**< The entry of each node */
+    std::vector<int> leaves; /**< The leaves of each tree in the order of the tour */
+    int nextPosition = 0; /**< The position of the next node to be entered */
+
+public:
+    /**
+     * @brief Constructs an empty HierarchyIndex object.
+     */
+    HierarchyIndex() = default;
+
+    /**
+     * @brief Constructs a HierarchyIndex object from the nodes of a supergraph.
+     * @param nodes The map from the id to the supernode
+     */
+    explicit HierarchyIndex(const std::map<int, WeightedSupernode> &nodes);
+
+    /**
+     * @brief Lay out the whole forest again.
+     * @param nodes The map from the id to the supernode
+     */
+    void rebuild(const std::map<int, WeightedSupernode> &nodes);
+
+    /**
+     * @brief Lay out again only the trees which contain the changed nodes, before and after the change.
+     * @param nodes The map from the id to the supernode
+     * @param changedNodes The nodes which were added, removed, or whose parent was changed
+     */
+    void update(const std::map<int, WeightedSupernode> &nodes, const std::vector<int> &changedNodes);
+
+    /**
+     * @brief Check if a node is in the index.
+     * @param id The id of the node
+     */
+    bool contains(int id) const;
+
+    /**
+     * @brief Check if a node is an ancestor of another node in O(1).
+     * @param ancestor The id of the ancestor
+     * @param descendant The id of the descendant
+     *
+     * @note A node is an ancestor of itself. If a node does not exist, throw an exception.
+     */
+    bool isAncestor(int ancestor, int descendant) const;
+
+    /**
+     * @brief Get the leaves under a node without copying them.
+     * @param id The id of the node
+     * @return The contiguous range of the leaves, the node itself if it has no children
+     *
+     * @note If the node does not exist, throw an exception.
+     */
+    std::span<const int> getLeaves(int id) const;
+
+    /**
+     * @brief Get the number of the leaves under a node in O(1).
+     * @param id The id of the node
+     *
+     * @note If the node does not exist, throw an exception.
+     */
+    size_t getLeafCount(int id) const;
+
+    /**
+     * @brief Get the root of the tree containing a node in O(1).
+     * @param id The id of the node
+     *
+     * @note If the node does not exist, throw an exception.
+     */
+    int getRoot(int id) const;
+
+    /**
+     * @brief Get the number of the ancestors of a node.
+     * @param id The id of the node
+     *
+     * @note If the node does not exist, throw an exception.
+     */
+    int getDepth(int id) const;
+
+    /**
+     * @brief Get the lowest common ancestor of two nodes in O(log n).
+     * @param first The id of the first node
+     * @param second The id of the second node
+     * @return The id of the lowest common ancestor, or WeightedSupernode::ROOT if the nodes are in different trees
+     *
+     * @note If a node does not exist, throw an exception.
+     */
+    int getLowestCommonAncestor(int first, int second) const;
+
+    /**
+     * @brief Get the number of nodes in the index.
+     */
+    size_t size() const;
+
+private:
+    const Entry& getEntry(int id) const;
+
+    /**
+     * @brief Lay out the tree of a root at the end of the arrays.
+     */
+    void layout(const std::map<int, WeightedSupernode> &nodes, int root);
+};
+
+} // namespace graph_structure
+} // namespace anagraph
+
+#endif // HIERARCHY_INDEX_HPP
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+
+#ifndef SUBGRAPH_VIEW_HPP
+#define SUBGRAPH_VIEW_HPP
+
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace anagraph {
+namespace graph_structure {
+
+/**
+ * @class SubgraphView
+ * @brief Represents the induced subgraph of a graph without copying it.
+ *
+ * @tparam GraphType The type of the parent graph, one of WeightedDigraph, WeightedGraph, Digraph and Graph
+ *
+ * @note The view refers to the parent graph, which must outlive the view.
+ * The nodes of the view are fixed at the construction and must not be removed from the parent graph,
+ * while the edges added to or removed from the parent graph are visible to the later calls of getAdjacents.
+ * The parent graph must not be modified while a range returned by getAdjacents is iterated.
+ * The nodes of the view are held as a bitmap over the range of their ids, and the adjacent nodes are filtered
+ * lazily through the bitmap. If the ids are too sparse for the bitmap, they are found by binary search instead.
+ */
+template <typename GraphType>
+class SubgraphView {
+public:
+    using AdjacentsType = std::remove_cvref_t<decltype(std::declval<const GraphType&>().getAdjacents(0))>;
+    using EntryType = typename AdjacentsType::value_type;
+
+private:
+    static constexpr size_t MAX_BITS_PER_NODE = 64; /**< The largest range of the ids per node to use the bitmap */
+
+    const GraphType *parent; /**< The graph the view refers to */
+    std::vector<int> ids; /**< The sorted ids of the nodes in the view */
+    int offset; /**< The id corresponding to the first bit of the bitmap */
+    std::vector<bool> members; /**< The bitmap of the nodes in the view, empty if the ids are sparse */
+
+    static int idOf(int id) {
+        return id;
+    }
+
+    static int idOf(const std::pair<const int, double> &entry) {
+        return entry.first;
+    }
+
+public:
+    /**
+     * @brief The predicate to filter the adjacent nodes in the view.
+     */
+    struct Contains {
+        const SubgraphView *view;
+
+        bool operator()(const EntryType &entry) const {
+            return view->contains(idOf(entry));
+        }
+    };
+
+    using AdjacentRange = std::ranges::filter_view<std::ranges::ref_view<const AdjacentsType>, Contains>;
+
+    /**
+     * @brief Constructs a SubgraphView object.
+     * @param graph The parent graph
+     * @param indices The ids of the nodes to include in the view
+     *
+     * @note If a node does not exist in the parent graph, throw an exception.
+     */
+    SubgraphView(const GraphType &graph, const std::unordered_set<int> &indices)
+        : SubgraphView(graph, std::vector<int>(indices.begin(), indices.end())) {}
+
+    /**
+     * @brief Constructs a SubgraphView object.
+     * @param graph The parent graph
+     * @param indices The ids of the nodes to include in the view, duplicates are ignored
+     *
+     * @note If a node does not exist in the parent graph, throw an exception.
+     */
+    SubgraphView(const GraphType &graph, std::vector<int> indices) : parent(&graph), ids(std::move(indices)), offset(0) {
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        if (ids.empty()) {
+            return;
+        }
+        for (int id : ids) {
+            // the parent graph throws std::out_of_range for a missing node
+            parent->getAdjacents(id);
+        }
+        offset = ids.front();
+        const size_t span = static_cast<size_t>(static_cast<long long>(ids.back()) - offset) + 1;
+        if (span > MAX_BITS_PER_NODE * ids.size()) {
+            return;
+        }
+        members.assign(span, false);
+        for (int id : ids) {
+            members[id - offset] = true;
+        }
+    }
+
+    /**
+     * @brief Get the parent graph of the view.
+     */
+    const GraphType& getParent() const {
+        return *parent;
+    }
+
+    /**
+     * @brief Get the ids of the nodes in the view.
+     * @return The ids sorted in ascending order
+     */
+    const std::vector<int>& getIds() const {
+        return ids;
+    }
+
+    /**
+     * @brief Check if a node is in the view.
+     * @param id The node to check
+     */
+    bool contains(int id) const {
+        if (members.empty()) {
+            return std::binary_search(ids.begin(), ids.end(), id);
+        }
+        if (id < offset || static_cast<size_t>(id) - offset >= members.size()) {
+            return false;
+        }
+        return members[id - offset];
+    }
+
+    /**
+     * @brief Get the adjacent nodes of a node in the view.
+     * @param id The source node
+     * @return The range of the adjacent entries of the parent graph whose node is in the view
+     *
+     * @note If the node is not in the view, throw an exception.
+     */
+    AdjacentRange getAdjacents(int id) const {
+        if (!contains(id)) {
+            throw std::out_of_range("Node does not exist");
+        }
+        return AdjacentRange(std::ranges::ref_view(parent->getAdjacents(id)), Contains{this});
+    }
+
+    /**
+     * @brief Get the number of nodes in the view.
+     */
+    size_t size() const {
+        return ids.size();
+    }
+
+    /**
+     * @brief Copy the view into a standalone graph.
+     * @return The induced subgraph of the parent graph
+     */
+    GraphType materialize() const {
+        GraphType subgraph;
+        for (int id : ids) {
+            subgraph.setNode(id);
+        }
+        for (int id : ids) {
+            for (const auto &entry : getAdjacents(id)) {
+                if constexpr (std::is_same_v<EntryType, int>) {
+                    subgraph.setEdge(id, entry);
+                } else {
+                    subgraph.setEdge(id, entry.first, entry.second);
+                }
+            }
+        }
+        return subgraph;
+    }
+};
+
+} // namespace graph_structure
+} // namespace anagraph
+
+#endif // SUBGRAPH_VIEW_HPP
\ No newline at end of file
@@ -7,8 +7,10 @@
 #include "anagraph/components/graph_parser.hpp"
 #include "anagraph/components/graph_writer.hpp"
 #include "anagraph/interfaces/unweighted_digraph_interface.hpp"
+#include "anagraph/utils/edge_range.hpp"
 #include "anagraph/utils/graph_utils.hpp"
 
+#include <unordered_map>
 #include <unordered_set>
 
 namespace anagraph {
@@ -71,6 +73,12 @@ public:
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
@@ -95,8 +103,10 @@ public:
      * @brief Get the subgraph of the graph.
      * @param indices The indices of the nodes to include in the subgraph
      * @return A subgraph of the graph
+     * 
+     * @note This method copies the induced subgraph. Use SubgraphView to access it without copying.
      */
-    Digraph getSubgraph(std::unordered_set<int> indices) const;
+    Digraph getSubgraph(const std::unordered_set<int> &indices) const;
 
     /**
      * @brief Reorganize the graph.
@@ -106,6 +116,33 @@ public:
      */
     void reorganize();
 
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     * Edges to ids which are not a node of the graph are dropped.
+     * 
+     * This method rebuilds the graph in a single pass over the nodes and edges.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap);
+
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * @param numThreads The number of threads to rewrite the adjacency lists
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     * Edges to ids which are not a node of the graph are dropped.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap, int numThreads);
+
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @return The range of (src, dst) in ascending order of src
+     */
+    EdgeRange<Node> getEdges() const;
+
     /**
      * @brief Get the number of nodes in the graph.
      */
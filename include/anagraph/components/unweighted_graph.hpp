@@ -8,8 +8,10 @@
 #include "anagraph/components/unweighted_node.hpp"
 #include "anagraph/components/unweighted_digraph.hpp"
 #include "anagraph/interfaces/unweighted_graph_interface.hpp"
+#include "anagraph/utils/edge_range.hpp"
 #include "anagraph/utils/graph_utils.hpp"
 
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -73,6 +75,12 @@ public:
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
@@ -91,14 +99,16 @@ public:
      * @brief Get the adjacent nodes of a node.
      * @param id The source node
      */
-    const std::unordered_set<int> getAdjacents(int id) const override;
+    const std::unordered_set<int>& getAdjacents(int id) const override;
 
     /**
      * @brief Get the subgraph of the graph.
      * @param indices The indices of the nodes to include in the subgraph
      * @return A subgraph of the graph
+     * 
+     * @note This method copies the induced subgraph. Use SubgraphView to access it without copying.
      */
-    Graph getSubgraph(std::unordered_set<int> indices) const;
+    Graph getSubgraph(const std::unordered_set<int> &indices) const;
 
     /**
      * @brief Reorganize the graph.
@@ -108,12 +118,44 @@ public:
      */
     void reorganize();
 
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap);
+
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * @param numThreads The number of threads to rewrite the adjacency lists
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap, int numThreads);
+
     /**
      * @brief Convert the graph to a digraph.
      * @return A digraph representation of the graph
      */
     Digraph toDigraph() const;
 
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @return The range of (src, dst) in ascending order of src
+     * 
+     * @note Each edge is visited in both directions.
+     */
+    EdgeRange<Node> getEdges() const;
+
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @param isDeduplicated If true, each edge is visited once as src <= dst
+     * @return The range of (src, dst) in ascending order of src
+     */
+    EdgeRange<Node> getEdges(bool isDeduplicated) const;
+
     /**
      * @brief Get the number of nodes in the graph.
      */
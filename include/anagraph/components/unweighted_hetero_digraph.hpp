@@ -83,6 +83,12 @@ public:
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
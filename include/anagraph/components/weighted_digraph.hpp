@@ -7,8 +7,10 @@
 #include "anagraph/components/graph_parser.hpp"
 #include "anagraph/components/graph_writer.hpp"
 #include "anagraph/interfaces/weighted_digraph_interface.hpp"
+#include "anagraph/utils/edge_range.hpp"
 #include "anagraph/utils/graph_utils.hpp"
 
+#include <unordered_map>
 #include <unordered_set>
 #include <map>
 
@@ -54,6 +56,12 @@ public:
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /** 
      * @brief Get the attributes of a node.
      * @param id The node to get the attributes of
@@ -138,8 +146,10 @@ public:
      * @brief Get the subgraph of the graph.
      * @param indices The indices of the nodes to include in the subgraph
      * @return A subgraph of the graph
+     * 
+     * @note This method copies the induced subgraph. Use SubgraphView to access it without copying.
      */
-    WeightedDigraph getSubgraph(std::unordered_set<int> indices) const;
+    WeightedDigraph getSubgraph(const std::unordered_set<int> &indices) const;
 
     /**
      * @brief Reorganize the graph.
@@ -149,6 +159,33 @@ public:
      */
     void reorganize();
 
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     * Edges to ids which are not a node of the graph are dropped.
+     * 
+     * This method rebuilds the graph in a single pass over the nodes and edges.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap);
+
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * @param numThreads The number of threads to rewrite the adjacency lists
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     * Edges to ids which are not a node of the graph are dropped.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap, int numThreads);
+
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @return The range of (src, dst, weight) in ascending order of src
+     */
+    EdgeRange<WeightedNode> getEdges() const;
+
     /**
      * @brief Get the number of nodes in the graph.
      */
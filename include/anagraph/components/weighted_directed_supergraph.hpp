@@ -5,11 +5,17 @@
 
 #include "anagraph/components/graph_parser.hpp"
 #include "anagraph/components/graph_writer.hpp"
+#include "anagraph/components/hierarchy_index.hpp"
 #include "anagraph/components/weighted_supernode.hpp"
 #include "anagraph/interfaces/weighted_digraph_interface.hpp"
+#include "anagraph/utils/edge_range.hpp"
 
 #include <functional>
 #include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace anagraph {
 namespace graph_structure {
@@ -26,8 +32,25 @@ class WeightedSuperDigraph : public interface::IWeightedDigraph {
 using mergeLambda = std::function<WeightedSupernode (WeightedSupernode&, WeightedSupernode&)>;
 
 private:
+    /**
+     * @brief The mutex guarding the lazy update of the hierarchy index, which is not copied with the graph.
+     */
+    struct HierarchyMutex {
+        std::mutex mutex;
+
+        HierarchyMutex() = default;
+        HierarchyMutex(const HierarchyMutex&) noexcept {}
+        HierarchyMutex& operator=(const HierarchyMutex&) noexcept {
+            return *this;
+        }
+    };
+
     std::map<int, WeightedSupernode> nodes;
     mergeLambda mergeNodeFunc;
+    mutable HierarchyIndex hierarchyIndex; /**< The flattened hierarchy, updated lazily on query */
+    mutable std::vector<int> hierarchyChanges; /**< The nodes changed since the last update of the index */
+    mutable bool isHierarchyStale = true; /**< Whether the index has to be rebuilt from scratch */
+    mutable HierarchyMutex hierarchyMutex;
 
 public:
     /**
@@ -122,11 +145,33 @@ public:
      */
     void setMergeNodeFunction(mergeLambda mergeFunc);
 
+    /**
+     * @brief Merge many pairs of nodes in a batch.
+     * @param pairs The pairs of root nodes to merge
+     * @return The map from each merged node to its new supernode
+     * 
+     * @note The pairs are grouped transitively, and each group becomes a new supernode whose children are the members.
+     * The new supernodes take the ids following the largest id of the graph, so they never collide with an existing node.
+     * The edges between root nodes incident to the members are redirected to the new supernodes,
+     * and the weights of the edges which become parallel are summed.
+     * Edges inside a group become a self loop of the new supernode.
+     * The members keep their own edges as the lower level of the hierarchy.
+     * If a node does not exist, throw std::out_of_range, and if a node is not a root node, throw std::invalid_argument.
+     * The cost is O(n + m log m) for the whole batch.
+     */
+    std::unordered_map<int, int> mergeNodes(const std::vector<std::pair<int, int>> &pairs);
+
     /**
      * @brief Get the id of the graph.
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
@@ -212,6 +257,19 @@ public:
      */
     std::unordered_set<int> getChildren(int id) const;
 
+    /**
+     * @brief Get the flattened index of the hierarchy.
+     * @return The index which answers ancestor, leaf and LCA queries
+     * 
+     * @note The index is updated on this call, only for the trees changed by setParent, updateParent, removeParent,
+     * setNode and removeNode since the last call.
+     * After getNode, mergeNode or readGraph, which may change the hierarchy directly, the whole index is rebuilt.
+     * The reference is invalidated by the next change of the graph.
+     * The update is guarded by a mutex, so that several threads can call this on the same graph,
+     * as long as no thread changes the graph meanwhile.
+     */
+    const HierarchyIndex& getHierarchyIndex() const;
+
     /**
      * @brief Get the adjacent nodes of a node.
      * @param id The source node
@@ -221,6 +279,12 @@ public:
      */
     const std::unordered_map<int, double>& getAdjacents(int id) const override;
 
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @return The range of (src, dst, weight) in ascending order of src
+     */
+    EdgeRange<WeightedSupernode> getEdges() const;
+
     /**
      * @brief Get the number of nodes in the graph.
      */
@@ -245,6 +309,12 @@ public:
     void writeGraph(std::string filePath, FileExtension extName) const override;
 
 private:
+    /**
+     * @brief Record a node whose place in the hierarchy may have changed.
+     * @param id The id of the node
+     */
+    void recordHierarchyChange(int id);
+
     /**
      * @brief Read the graph from a file.
      * @param filePath The name of the file to import the graph from
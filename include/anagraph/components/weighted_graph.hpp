@@ -7,6 +7,7 @@
 #include "anagraph/components/graph_writer.hpp"
 #include "anagraph/components/weighted_digraph.hpp"
 #include "anagraph/interfaces/weighted_graph_interface.hpp"
+#include "anagraph/utils/edge_range.hpp"
 #include "anagraph/utils/graph_utils.hpp"
 
 #include <memory>
@@ -70,6 +71,12 @@ public:
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /**
      * @brief Set a node to the graph.
      * @param node The node to add
@@ -137,8 +144,10 @@ public:
      * @brief Get the subgraph of the graph.
      * @param indices The indices of the nodes to include in the subgraph
      * @return A subgraph of the graph
+     * 
+     * @note This method copies the induced subgraph. Use SubgraphView to access it without copying.
      */
-    WeightedGraph getSubgraph(std::unordered_set<int> indices) const;
+    WeightedGraph getSubgraph(const std::unordered_set<int> &indices) const;
 
     /**
      * @brief Reorganize the graph.
@@ -148,6 +157,38 @@ public:
      */
     void reorganize();
 
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap);
+
+    /**
+     * @brief Relabel the nodes of the graph.
+     * @param idMap The map from the old id to the new id of each node
+     * @param numThreads The number of threads to rewrite the adjacency lists
+     * 
+     * @note idMap must contain every node and map them to distinct ids.
+     */
+    void relabel(const std::unordered_map<int, int> &idMap, int numThreads);
+
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @return The range of (src, dst, weight) in ascending order of src
+     * 
+     * @note Each edge is visited in both directions.
+     */
+    EdgeRange<WeightedNode> getEdges() const;
+
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @param isDeduplicated If true, each edge is visited once as src <= dst
+     * @return The range of (src, dst, weight) in ascending order of src
+     */
+    EdgeRange<WeightedNode> getEdges(bool isDeduplicated) const;
+
     /**
      * @brief Get the number of nodes in the graph.
      */
@@ -5,6 +5,7 @@
 
 #include "anagraph/components/weighted_directed_supergraph.hpp"
 #include "anagraph/interfaces/weighted_graph_interface.hpp"
+#include "anagraph/utils/edge_range.hpp"
 
 namespace anagraph {
 namespace graph_structure {
@@ -116,11 +117,32 @@ public:
      */
     void setMergeNodeFunction(mergeLambda mergeFunc);
 
+    /**
+     * @brief Merge many pairs of nodes in a batch.
+     * @param pairs The pairs of root nodes to merge
+     * @return The map from each merged node to its new supernode
+     * 
+     * @note The pairs are grouped transitively, and each group becomes a new supernode whose children are the members.
+     * The new supernodes take the ids following the largest id of the graph, so they never collide with an existing node.
+     * The edges between root nodes incident to the members are redirected to the new supernodes,
+     * and the weights of the edges which become parallel are summed.
+     * Edges inside a group become a self loop of the new supernode, each undirected edge counted once.
+     * The members keep their own edges as the lower level of the hierarchy.
+     * If a node does not exist, throw std::out_of_range, and if a node is not a root node, throw std::invalid_argument.
+     */
+    std::unordered_map<int, int> mergeNodes(const std::vector<std::pair<int, int>> &pairs);
+
     /**
      * @brief Get the id of the graph.
      */
     std::unordered_set<int> getIds() const override;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    IdRange getIdRange() const override;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
@@ -204,6 +226,14 @@ public:
      */
     std::unordered_set<int> getChildren(int id) const;
 
+    /**
+     * @brief Get the flattened index of the hierarchy.
+     * @return The index which answers ancestor, leaf and LCA queries
+     * 
+     * @note The index is updated lazily under a mutex, see WeightedSuperDigraph::getHierarchyIndex.
+     */
+    const HierarchyIndex& getHierarchyIndex() const;
+
     /**
      * @brief Get the adjacent nodes of a node.
      * @param id The source node
@@ -213,6 +243,21 @@ public:
      */
     const std::unordered_map<int, double>& getAdjacents(int id) const override;
 
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @return The range of (src, dst, weight) in ascending order of src
+     * 
+     * @note Each edge is visited in both directions.
+     */
+    EdgeRange<WeightedSupernode> getEdges() const;
+
+    /**
+     * @brief Get the edges of the graph without copying them.
+     * @param isDeduplicated If true, each edge is visited once as src <= dst
+     * @return The range of (src, dst, weight) in ascending order of src
+     */
+    EdgeRange<WeightedSupernode> getEdges(bool isDeduplicated) const;
+
     /**
      * @brief Get the number of nodes in the graph.
      */
@@ -4,6 +4,7 @@
 #define UNWEIGHTED_DIGRAPH_INTERFACE_HPP
 
 #include "anagraph/utils/graph_utils.hpp"
+#include "anagraph/utils/id_range.hpp"
 
 #include <string>
 #include <unordered_set>
@@ -58,6 +59,12 @@ public:
      */
     virtual std::unordered_set<int> getIds() const = 0;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    virtual IdRange getIdRange() const = 0;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
@@ -4,6 +4,7 @@
 #define UNWEIGHTED_GRAPH_INTERFACE_HPP
 
 #include "anagraph/utils/graph_utils.hpp"
+#include "anagraph/utils/id_range.hpp"
 
 #include <string>
 #include <unordered_set>
@@ -52,6 +53,12 @@ public:
      */
     virtual std::unordered_set<int> getIds() const = 0;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    virtual IdRange getIdRange() const = 0;
+
     /**
      * @brief Remove a node from the graph.
      * @param id The node to remove
@@ -76,7 +83,7 @@ public:
      * @brief Get the adjacent nodes of a node.
      * @param id The source node
      */
-    virtual const std::unordered_set<int> getAdjacents(int id) const = 0;
+    virtual const std::unordered_set<int>& getAdjacents(int id) const = 0;
 
     /**
      * @brief Get the number of nodes in the graph.
@@ -3,6 +3,8 @@
 #ifndef UNWEIGHTED_HETERO_DIGRAPH_INTERFACE_HPP
 #define UNWEIGHTED_HETERO_DIGRAPH_INTERFACE_HPP
 
+#include "anagraph/utils/id_range.hpp"
+
 namespace anagraph {
 namespace interface {
 
@@ -52,6 +54,12 @@ public:
      */
     virtual std::unordered_set<int> getIds() const = 0;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    virtual IdRange getIdRange() const = 0;
+
     /**
      * @brief Remove a node from the graph.
      * @param id The node to remove
@@ -4,6 +4,7 @@
 #define WEIGHTED_GRAPH_INTERFACE_HPP
 
 #include "anagraph/utils/graph_utils.hpp"
+#include "anagraph/utils/id_range.hpp"
 
 #include <string>
 #include <unordered_map>
@@ -46,6 +47,12 @@ public:
      */
     virtual std::unordered_set<int> getIds() const = 0;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    virtual IdRange getIdRange() const = 0;
+
     /**
      * @brief Set a node to the graph.
      * @param id The node to add
@@ -3,6 +3,8 @@
 #ifndef WEIGHTED_HETERO_GRAPH_INTERFACE_HPP
 #define WEIGHTED_HETERO_GRAPH_INTERFACE_HPP
 
+#include "anagraph/utils/id_range.hpp"
+
 namespace anagraph {
 namespace interface {
 
@@ -60,6 +62,12 @@ public:
      */
     virtual std::unordered_set<int> getIds() const = 0;
 
+    /**
+     * @brief Get the ids of the graph without copying them.
+     * @return The range of the ids in ascending order
+     */
+    virtual IdRange getIdRange() const = 0;
+
     /**
      * @brief Add an edge between two nodes.
      * @param src The source node
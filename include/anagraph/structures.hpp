@@ -19,4 +19,7 @@
 #include "anagraph/components/weighted_hetero_digraph.hpp"
 #include "anagraph/components/weighted_hetero_node.hpp"
 
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/components/subgraph_view.hpp"
+
 #endif // ANAGRAPH_COMPONENT_HPP
\ No newline at end of file
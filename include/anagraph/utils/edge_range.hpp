@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef EDGE_RANGE_HPP
+#define EDGE_RANGE_HPP
+
+#include "anagraph/utils/graph_utils.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+
+namespace anagraph {
+
+/**
+ * @class EdgeRange
+ * @brief Represents the edges of a graph without copying them.
+ *
+ * @tparam NodeType The type of the nodes in the node map of the graph
+ *
+ * @note The range refers to the node map of the graph, which must not be modified while the range is used.
+ * The edges are visited in ascending order of the source node.
+ * Each edge is yielded as WeightedEdgeObject (src, dst, weight) for weighted nodes,
+ * and as EdgeObject (src, dst) for unweighted nodes.
+ */
+template <typename NodeType>
+class EdgeRange {
+private:
+    using NodeMap = std::map<int, NodeType>;
+    using AdjacentsType = std::remove_cvref_t<decltype(std::declval<const NodeType&>().getAdjacents())>;
+    static constexpr bool isWeighted = !std::is_same_v<typename AdjacentsType::value_type, int>;
+
+public:
+    using EdgeType = std::conditional_t<isWeighted, WeightedEdgeObject, EdgeObject>;
+
+    /**
+     * @class Iterator
+     * @brief The forward iterator over the edges.
+     */
+    class Iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = EdgeType;
+        using difference_type = std::ptrdiff_t;
+        using reference = EdgeType;
+
+    private:
+        typename NodeMap::const_iterator node; /**< The source node */
+        typename NodeMap::const_iterator nodeEnd; /**< The end of the node map */
+        typename AdjacentsType::const_iterator adjacent; /**< The current adjacent entry of the source node */
+        bool isDeduplicated; /**< Whether edges with dst < src are skipped */
+
+        static int dstOf(int dst) {
+            return dst;
+        }
+
+        static int dstOf(const std::pair<const int, double> &entry) {
+            return entry.first;
+        }
+
+        /**
+         * @brief Move to the next edge to yield, starting from the current position.
+         */
+        void settle() {
+            while (node != nodeEnd) {
+                const auto &adjacents = node->second.getAdjacents();
+                if (adjacent == adjacents.end()) {
+                    ++node;
+                    if (node != nodeEnd) {
+                        adjacent = node->second.getAdjacents().begin();
+                    }
+                    continue;
+                }
+                if (isDeduplicated && dstOf(*adjacent) < node->first) {
+                    ++adjacent;
+                    continue;
+                }
+                return;
+            }
+        }
+
+    public:
+        Iterator() : isDeduplicated(false) {}
+
+        Iterator(typename NodeMap::const_iterator node, typename NodeMap::const_iterator nodeEnd, bool isDeduplicated)
+            : node(node), nodeEnd(nodeEnd), isDeduplicated(isDeduplicated) {
+            if (node != nodeEnd) {
+                adjacent = node->second.getAdjacents().begin();
+                settle();
+            }
+        }
+
+        EdgeType operator*() const {
+            if constexpr (isWeighted) {
+                return EdgeType(node->first, adjacent->first, adjacent->second);
+            } else {
+                return EdgeType(node->first, *adjacent);
+            }
+        }
+
+        Iterator& operator++() {
+            ++adjacent;
+            settle();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const Iterator &other) const {
+            if (node != other.node) {
+                return false;
+            }
+            return node == nodeEnd || adjacent == other.adjacent;
+        }
+    };
+
+private:
+    const NodeMap *nodes; /**< The node map of the graph */
+    bool isDeduplicated; /**< Whether edges with dst < src are skipped */
+
+public:
+    /**
+     * @brief Constructs an EdgeRange object over a node map.
+     * @param nodes The map from the id to the node
+     * @param isDeduplicated If true, only the edges with src <= dst are visited
+     */
+    EdgeRange(const NodeMap &nodes, bool isDeduplicated) : nodes(&nodes), isDeduplicated(isDeduplicated) {}
+
+    /**
+     * @brief Get the range which visits only the edges with src <= dst.
+     *
+     * This method is used by undirected graphs to visit each edge once.
+     */
+    EdgeRange deduplicated() const {
+        return EdgeRange(*nodes, true);
+    }
+
+    Iterator begin() const {
+        return Iterator(nodes->cbegin(), nodes->cend(), isDeduplicated);
+    }
+
+    Iterator end() const {
+        return Iterator(nodes->cend(), nodes->cend(), isDeduplicated);
+    }
+};
+
+} // namespace anagraph
+
+#endif // EDGE_RANGE_HPP
\ No newline at end of file
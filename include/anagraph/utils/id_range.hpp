@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef ID_RANGE_HPP
+#define ID_RANGE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+namespace anagraph {
+
+/**
+ * @class IdRange
+ * @brief Represents the ids of the nodes of a graph without copying them.
+ *
+ * @note The range refers to the node map of the graph, which must not be modified while the range is used.
+ * The ids are visited in ascending order.
+ *
+ * The iterator of the node map is stored in place, so that neither the range nor its iterators allocate.
+ */
+class IdRange {
+public:
+    /**
+     * @class Iterator
+     * @brief The forward iterator over the ids.
+     */
+    class Iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using reference = int;
+
+    private:
+        /**
+         * @brief The operations on the stored map iterator.
+         */
+        struct Operations {
+            void (*copy)(void *dst, const void *src);
+            void (*destroy)(void *it);
+            void (*increment)(void *it);
+            int (*dereference)(const void *it);
+            bool (*equal)(const void *a, const void *b);
+        };
+
+        template <typename MapIterator>
+        static const Operations* operationsOf() {
+            static constexpr Operations operations = {
+                [](void *dst, const void *src) { new (dst) MapIterator(*static_cast<const MapIterator*>(src)); },
+                [](void *it) { static_cast<MapIterator*>(it)->~MapIterator(); },
+                [](void *it) { ++*static_cast<MapIterator*>(it); },
+                [](const void *it) -> int { return (*static_cast<const MapIterator*>(it))->first; },
+                [](const void *a, const void *b) { return *static_cast<const MapIterator*>(a) == *static_cast<const MapIterator*>(b); },
+            };
+            return &operations;
+        }
+
+        static constexpr size_t storageSize = 4 * sizeof(void*);
+        alignas(std::max_align_t) std::byte storage[storageSize]; /**< The stored map iterator */
+        const Operations *operations; /**< nullptr for the default constructed iterator */
+
+    public:
+        Iterator() : operations(nullptr) {}
+
+        /**
+         * @brief Constructs an Iterator object from an iterator of the node map.
+         * @param it The iterator of the map whose key is the id
+         */
+        template <typename MapIterator>
+        explicit Iterator(MapIterator it) : operations(operationsOf<MapIterator>()) {
+            static_assert(sizeof(MapIterator) <= storageSize, "the map iterator is too large to store in place");
+            static_assert(alignof(MapIterator) <= alignof(std::max_align_t), "the map iterator is over-aligned");
+            new (storage) MapIterator(it);
+        }
+
+        Iterator(const Iterator &other) : operations(other.operations) {
+            if (operations != nullptr) {
+                operations->copy(storage, other.storage);
+            }
+        }
+
+        Iterator& operator=(const Iterator &other) {
+            if (this != &other) {
+                if (operations != nullptr) {
+                    operations->destroy(storage);
+                }
+                operations = other.operations;
+                if (operations != nullptr) {
+                    operations->copy(storage, other.storage);
+                }
+            }
+            return *this;
+        }
+
+        ~Iterator() {
+            if (operations != nullptr) {
+                operations->destroy(storage);
+            }
+        }
+
+        int operator*() const {
+            return operations->dereference(storage);
+        }
+
+        Iterator& operator++() {
+            operations->increment(storage);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const Iterator &other) const {
+            if (operations == nullptr || other.operations == nullptr) {
+                return operations == other.operations;
+            }
+            return operations->equal(storage, other.storage);
+        }
+    };
+
+private:
+    Iterator first; /**< The iterator to the first id */
+    Iterator last; /**< The iterator after the last id */
+    size_t count; /**< The number of ids */
+
+public:
+    /**
+     * @brief Constructs an empty IdRange object.
+     */
+    IdRange() : count(0) {}
+
+    /**
+     * @brief Constructs an IdRange object over the keys of a map.
+     * @param nodes The map from the id to the node
+     */
+    template <typename MapType>
+    explicit IdRange(const MapType &nodes) : first(nodes.cbegin()), last(nodes.cend()), count(nodes.size()) {}
+
+    Iterator begin() const {
+        return first;
+    }
+
+    Iterator end() const {
+        return last;
+    }
+
+    /**
+     * @brief Get the number of ids.
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief Check if the range has no ids.
+     */
+    bool empty() const {
+        return count == 0;
+    }
+};
+
+} // namespace anagraph
+
+#endif // ID_RANGE_HPP
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef PARALLEL_UTILS_HPP
+#define PARALLEL_UTILS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace anagraph {
+namespace parallel {
+
+/**
+ * @brief Get the number of threads used when the caller does not specify it.
+ * @return The number of hardware threads, at least 1
+ */
+inline int defaultThreadCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Run func(i) for every i in [begin, end) on numThreads threads.
+ * @param begin The first index
+ * @param end The index after the last one
+ * @param numThreads The number of threads, 1 runs the loop on the calling thread
+ * @param func The function called with each index
+ *
+ * @note The range is split into contiguous blocks, one per thread.
+ * func must be safe to call concurrently for different indices.
+ */
+template <typename Func>
+void parallelFor(size_t begin, size_t end, int numThreads, Func &&func) {
+    if (begin >= end) {
+        return;
+    }
+    const size_t total = end - begin;
+    const size_t threads = std::min(static_cast<size_t>(std::max(numThreads, 1)), total);
+    if (threads == 1) {
+        for (size_t i = begin; i < end; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    const size_t blockSize = (total + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; t++) {
+        const size_t blockBegin = begin + t * blockSize;
+        const size_t blockEnd = std::min(end, blockBegin + blockSize);
+        if (blockBegin >= blockEnd) {
+            break;
+        }
+        workers.emplace_back([blockBegin, blockEnd, &func]() {
+            for (size_t i = blockBegin; i < blockEnd; i++) {
+                func(i);
+            }
+        });
+    }
+    // the calling thread takes the first block
+    for (size_t i = begin; i < std::min(end, begin + blockSize); i++) {
+        func(i);
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace parallel
+} // namespace anagraph
+
+#endif // PARALLEL_UTILS_HPP
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef UNION_FIND_HPP
+#define UNION_FIND_HPP
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace anagraph {
+
+/**
+ * @class UnionFind
+ * @brief Represents disjoint sets of the indices 0 to size - 1.
+ *
+ * @note find uses path halving and unite uses union by size,
+ * so a sequence of operations runs in almost linear time.
+ */
+class UnionFind {
+private:
+    std::vector<int> parents; /**< The parent of each index, a root is its own parent */
+    std::vector<int> sizes; /**< The size of the set, valid only for the roots */
+
+public:
+    /**
+     * @brief Constructs a UnionFind object of singleton sets.
+     * @param size The number of indices
+     */
+    explicit UnionFind(size_t size) : parents(size), sizes(size, 1) {
+        std::iota(parents.begin(), parents.end(), 0);
+    }
+
+    /**
+     * @brief Get the representative of the set containing an index.
+     * @param index The index to find
+     */
+    int find(int index) {
+        while (parents[index] != index) {
+            parents[index] = parents[parents[index]];
+            index = parents[index];
+        }
+        return index;
+    }
+
+    /**
+     * @brief Unite the sets containing two indices.
+     * @param first The first index
+     * @param second The second index
+     * @return true if the indices were in different sets
+     */
+    bool unite(int first, int second) {
+        first = find(first);
+        second = find(second);
+        if (first == second) {
+            return false;
+        }
+        if (sizes[first] < sizes[second]) {
+            std::swap(first, second);
+        }
+        parents[second] = first;
+        sizes[first] += sizes[second];
+        return true;
+    }
+
+    /**
+     * @brief Get the size of the set containing an index.
+     * @param index The index in the set
+     */
+    int setSize(int index) {
+        return sizes[find(index)];
+    }
+
+    /**
+     * @brief Get the number of indices.
+     */
+    size_t size() const {
+        return parents.size();
+    }
+};
+
+} // namespace anagraph
+
+#endif // UNION_FIND_HPP
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "anagraph/algorithms/bfs.hpp"
+
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    // the thresholds to switch the direction, from Beamer et al., "Direction-Optimizing Breadth-First Search"
+    constexpr size_t TOP_DOWN_RATIO = 14;
+    constexpr size_t BOTTOM_UP_RATIO = 24;
+    constexpr size_t WORD_BITS = 64;
+
+    bool hasBit(const std::vector<uint64_t> &bitmap, int index) {
+        return (bitmap[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+    }
+
+    /**
+     * @brief Lower the parent of a node to the smaller index, so that the result does not depend on the threads.
+     */
+    void updateParent(int &parent, int candidate) {
+        std::atomic_ref<int> atomicParent(parent);
+        int current = atomicParent.load(std::memory_order_relaxed);
+        while (candidate < current && !atomicParent.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Expand the frontier along the out-edges.
+     * @return The number of the out-edges of the next frontier
+     */
+    size_t topDownStep(const CompressedGraph &graph, std::vector<int> &distances, std::vector<int> &parents, std::vector<int> &queue, int level, int numThreads) {
+        const size_t blocks = std::min(static_cast<size_t>(numThreads), queue.size());
+        const size_t blockSize = (queue.size() + blocks - 1) / blocks;
+        std::vector<std::vector<int>> nextQueues(blocks);
+        std::vector<size_t> scoutCounts(blocks, 0);
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            const size_t blockEnd = std::min(queue.size(), (block + 1) * blockSize);
+            for (size_t i = block * blockSize; i < blockEnd; i++) {
+                const int src = queue[i];
+                for (const int dst : graph.getAdjacents(src)) {
+                    std::atomic_ref<int> distance(distances[dst]);
+                    int current = distance.load(std::memory_order_relaxed);
+                    if (current == bfs::UNREACHED && distance.compare_exchange_strong(current, level + 1, std::memory_order_relaxed)) {
+                        nextQueues[block].push_back(dst);
+                        scoutCounts[block] += graph.getDegree(dst);
+                        current = level + 1;
+                    }
+                    // another node of the frontier may have reached dst in this level
+                    if (current == level + 1) {
+                        updateParent(parents[dst], src);
+                    }
+                }
+            }
+        });
+
+        queue.clear();
+        size_t scoutCount = 0;
+        for (size_t block = 0; block < blocks; block++) {
+            queue.insert(queue.end(), nextQueues[block].begin(), nextQueues[block].end());
+            scoutCount += scoutCounts[block];
+        }
+        return scoutCount;
+    }
+
+    /**
+     * @brief Find a parent in the frontier for each unvisited node along its in-edges.
+     * @return The number of the nodes and of the out-edges of the next frontier
+     */
+    std::pair<size_t, size_t> bottomUpStep(const CompressedGraph &graph, const CompressedGraph &transposed, std::vector<int> &distances, std::vector<int> &parents, std::vector<uint64_t> &frontier, std::vector<uint64_t> &next, int level, int numThreads) {
+        const size_t size = graph.size();
+        std::atomic<size_t> awakeCount = 0;
+        std::atomic<size_t> scoutCount = 0;
+        // each call owns the nodes of one word, so that the next frontier is written without atomics
+        parallel::parallelFor(0, frontier.size(), numThreads, [&](size_t word) {
+            uint64_t bits = 0;
+            size_t awake = 0;
+            size_t scout = 0;
+            const size_t wordEnd = std::min(size, (word + 1) * WORD_BITS);
+            for (size_t dst = word * WORD_BITS; dst < wordEnd; dst++) {
+                if (distances[dst] != bfs::UNREACHED) {
+                    continue;
+                }
+                // the in-edges are sorted, so the parent is the smallest index in the frontier as in the top-down step
+                for (const int src : transposed.getAdjacents(dst)) {
+                    if (hasBit(frontier, src)) {
+                        distances[dst] = level + 1;
+                        parents[dst] = src;
+                        bits |= uint64_t{1} << (dst % WORD_BITS);
+                        awake++;
+                        scout += graph.getDegree(dst);
+                        break;
+                    }
+                }
+            }
+            next[word] = bits;
+            if (awake > 0) {
+                awakeCount += awake;
+                scoutCount += scout;
+            }
+        });
+        frontier.swap(next);
+        return {awakeCount.load(), scoutCount.load()};
+    }
+
+    void queueToBitmap(const std::vector<int> &queue, std::vector<uint64_t> &bitmap) {
+        std::fill(bitmap.begin(), bitmap.end(), 0);
+        for (const int index : queue) {
+            bitmap[index / WORD_BITS] |= uint64_t{1} << (index % WORD_BITS);
+        }
+    }
+
+    void bitmapToQueue(const std::vector<uint64_t> &bitmap, std::vector<int> &queue) {
+        queue.clear();
+        for (size_t word = 0; word < bitmap.size(); word++) {
+            for (uint64_t bits = bitmap[word]; bits != 0; bits &= bits - 1) {
+                queue.push_back(static_cast<int>(word * WORD_BITS + std::countr_zero(bits)));
+            }
+        }
+    }
+}
+
+namespace anagraph {
+namespace bfs {
+
+BFSResult breadthFirstSearch(const graph_structure::Digraph &graph, int source) {
+    return breadthFirstSearch(graph, source, 1);
+}
+
+BFSResult breadthFirstSearch(const graph_structure::Digraph &graph, int source, int numThreads) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return breadthFirstSearch(compressed, compressed.transpose(), source, numThreads);
+}
+
+BFSResult breadthFirstSearch(const graph_structure::Graph &graph, int source) {
+    return breadthFirstSearch(graph, source, 1);
+}
+
+BFSResult breadthFirstSearch(const graph_structure::Graph &graph, int source, int numThreads) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return breadthFirstSearch(compressed, compressed, source, numThreads);
+}
+
+BFSResult breadthFirstSearch(const graph_structure::CompressedGraph &graph, const graph_structure::CompressedGraph &transposed, int source, int numThreads) {
+    const size_t size = graph.size();
+    if (transposed.size() != size || transposed.edgeSize() != graph.edgeSize()) {
+        throw std::invalid_argument("The transposed graph does not match the graph");
+    }
+    const int sourceIndex = graph.getIndex(source);
+    const int threads = std::max(1, numThreads);
+
+    // the parents are indices during the search, and size means no parent yet
+    std::vector<int> distances(size, UNREACHED);
+    std::vector<int> parents(size, static_cast<int>(size));
+    distances[sourceIndex] = 0;
+    parents[sourceIndex] = sourceIndex;
+
+    std::vector<int> queue = {sourceIndex};
+    std::vector<uint64_t> frontier((size + WORD_BITS - 1) / WORD_BITS, 0);
+    std::vector<uint64_t> next(frontier.size(), 0);
+    bool isBottomUp = false;
+    size_t awakeCount = 1;
+    size_t scoutCount = graph.getDegree(sourceIndex);
+    size_t edgesToCheck = graph.edgeSize() - scoutCount;
+    size_t bottomUpLevels = 0;
+    for (int level = 0; awakeCount > 0; level++) {
+        if (!isBottomUp && scoutCount > edgesToCheck / TOP_DOWN_RATIO) {
+            queueToBitmap(queue, frontier);
+            isBottomUp = true;
+        }
+        if (isBottomUp) {
+            const size_t previousAwakeCount = awakeCount;
+            std::tie(awakeCount, scoutCount) = bottomUpStep(graph, transposed, distances, parents, frontier, next, level, threads);
+            bottomUpLevels++;
+            if (awakeCount < previousAwakeCount && awakeCount < size / BOTTOM_UP_RATIO) {
+                bitmapToQueue(frontier, queue);
+                isBottomUp = false;
+            }
+        } else {
+            scoutCount = topDownStep(graph, distances, parents, queue, level, threads);
+            awakeCount = queue.size();
+        }
+        edgesToCheck -= std::min(edgesToCheck, scoutCount);
+    }
+    spdlog::debug("BFS from {} expanded {} levels bottom-up", source, bottomUpLevels);
+
+    BFSResult result;
+    result.parents.resize(size, UNREACHED);
+    for (size_t i = 0; i < size; i++) {
+        if (distances[i] != UNREACHED) {
+            result.parents[i] = graph.getId(parents[i]);
+        }
+    }
+    result.distances = std::move(distances);
+    return result;
+}
+
+} // namespace bfs
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,415 @@
+#include "anagraph/algorithms/centrality.hpp"
+
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+    constexpr uint64_t SAMPLE_SEED = 2718281828;
+    constexpr int DEFAULT_LOG2M = 10;
+
+    /**
+     * @brief Check the weights, and whether every weight is 1 so that BFS finds the shortest paths.
+     */
+    bool isUnitWeighted(const CompressedGraph &graph) {
+        bool isUnit = true;
+        for (const double weight : graph.getWeights()) {
+            if (!(weight > 0)) {
+                throw std::invalid_argument("Weights must be positive");
+            }
+            isUnit = isUnit && weight == 1.0;
+        }
+        return isUnit;
+    }
+
+    /**
+     * @class DependencyAccumulator
+     * @brief The state of Brandes' algorithm for a single thread, reset only on the nodes reached from the last source.
+     */
+    class DependencyAccumulator {
+    private:
+        const CompressedGraph &graph;
+        const bool isUnit;
+        std::vector<double> distances;
+        std::vector<double> paths; /**< The number of the shortest paths from the source */
+        std::vector<double> dependencies;
+        std::vector<int> order; /**< The reached nodes in the ascending order of the distances */
+
+        void countPathsByBFS(int source) {
+            order.push_back(source);
+            for (size_t head = 0; head < order.size(); head++) {
+                const int node = order[head];
+                for (const int adjacent : graph.getAdjacents(node)) {
+                    if (distances[adjacent] == INFINITE_DISTANCE) {
+                        distances[adjacent] = distances[node] + 1;
+                        order.push_back(adjacent);
+                    }
+                    if (distances[adjacent] == distances[node] + 1) {
+                        paths[adjacent] += paths[node];
+                    }
+                }
+            }
+        }
+
+        void countPathsByDijkstra(int source) {
+            using Entry = std::pair<double, int>;
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+            heap.emplace(0.0, source);
+            while (!heap.empty()) {
+                const auto [distance, node] = heap.top();
+                heap.pop();
+                if (distance > distances[node]) {
+                    continue;
+                }
+                // every predecessor is nearer by a positive weight, so the paths to the node are already counted
+                order.push_back(node);
+                const auto adjacents = graph.getAdjacents(node);
+                const auto weights = graph.getWeights(node);
+                for (size_t i = 0; i < adjacents.size(); i++) {
+                    const int adjacent = adjacents[i];
+                    const double next = distance + weights[i];
+                    if (next < distances[adjacent]) {
+                        distances[adjacent] = next;
+                        paths[adjacent] = paths[node];
+                        heap.emplace(next, adjacent);
+                    } else if (next == distances[adjacent]) {
+                        paths[adjacent] += paths[node];
+                    }
+                }
+            }
+        }
+
+    public:
+        DependencyAccumulator(const CompressedGraph &graph, bool isUnit)
+            : graph(graph), isUnit(isUnit), distances(graph.size(), INFINITE_DISTANCE), paths(graph.size(), 0.0), dependencies(graph.size(), 0.0) {}
+
+        /**
+         * @brief Add the dependencies of a source on the other nodes, multiplied by a scale, to the scores.
+         */
+        void accumulate(int source, double scale, std::vector<double> &scores) {
+            distances[source] = 0.0;
+            paths[source] = 1.0;
+            if (isUnit) {
+                countPathsByBFS(source);
+            } else {
+                countPathsByDijkstra(source);
+            }
+
+            // the successors of a node on the shortest paths are its adjacents farther by the weight of the edge
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                const int node = *it;
+                const auto adjacents = graph.getAdjacents(node);
+                const auto weights = graph.getWeights(node);
+                double dependency = 0.0;
+                for (size_t i = 0; i < adjacents.size(); i++) {
+                    const int adjacent = adjacents[i];
+                    if (distances[adjacent] == distances[node] + weights[i]) {
+                        dependency += paths[node] / paths[adjacent] * (1.0 + dependencies[adjacent]);
+                    }
+                }
+                dependencies[node] = dependency;
+                if (node != source) {
+                    scores[node] += scale * dependency;
+                }
+            }
+
+            for (const int node : order) {
+                distances[node] = INFINITE_DISTANCE;
+                paths[node] = 0.0;
+                dependencies[node] = 0.0;
+            }
+            order.clear();
+        }
+    };
+
+    /**
+     * @brief Accumulate the dependencies of the sources, each block of the sources on its own thread.
+     */
+    std::vector<double> accumulateSources(const CompressedGraph &graph, bool isUnit, const std::vector<int> &sources, double scale, int numThreads) {
+        const size_t size = graph.size();
+        const size_t blocks = std::max<size_t>(1, std::min(static_cast<size_t>(std::max(1, numThreads)), sources.size()));
+        const size_t blockSize = (sources.size() + blocks - 1) / blocks;
+        std::vector<std::vector<double>> blockScores(blocks);
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            blockScores[block].resize(size, 0.0);
+            DependencyAccumulator accumulator(graph, isUnit);
+            const size_t blockEnd = std::min(sources.size(), (block + 1) * blockSize);
+            for (size_t i = block * blockSize; i < blockEnd; i++) {
+                accumulator.accumulate(sources[i], scale, blockScores[block]);
+            }
+        });
+        std::vector<double> scores(size, 0.0);
+        for (const auto &block : blockScores) {
+            for (size_t node = 0; node < block.size(); node++) {
+                scores[node] += block[node];
+            }
+        }
+        return scores;
+    }
+
+    /**
+     * @brief Hash a node by splitmix64, to place it in a register of a HyperLogLog counter.
+     */
+    uint64_t mix(uint64_t value) {
+        value += 0x9e3779b97f4a7c15;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief Estimate the size of the set counted by the registers of a HyperLogLog counter.
+     */
+    double estimateSize(const uint8_t *registers, size_t registerCount) {
+        double sum = 0.0;
+        size_t zeros = 0;
+        for (size_t i = 0; i < registerCount; i++) {
+            sum += std::ldexp(1.0, -registers[i]);
+            zeros += registers[i] == 0 ? 1 : 0;
+        }
+        const double m = registerCount;
+        const double alpha = registerCount == 16 ? 0.673 : registerCount == 32 ? 0.697 : registerCount == 64 ? 0.709 : 0.7213 / (1 + 1.079 / m);
+        const double estimate = alpha * m * m / sum;
+        // the linear counting is more accurate for a small set
+        if (estimate <= 2.5 * m && zeros > 0) {
+            return m * std::log(m / zeros);
+        }
+        return estimate;
+    }
+
+    /**
+     * @struct Balls
+     * @brief The sums over the balls of the nodes estimated by HyperBall.
+     */
+    struct Balls {
+        std::vector<double> harmonics; /**< The sum of 1 / d over the reached nodes */
+        std::vector<double> distanceSums; /**< The sum of d over the reached nodes */
+        std::vector<double> sizes; /**< The number of the reached nodes, including the node itself */
+    };
+
+    Balls hyperBall(const CompressedGraph &graph, int log2m, int numThreads) {
+        if (log2m < 4 || log2m > 16) {
+            throw std::invalid_argument("log2m must be in [4, 16]");
+        }
+        const size_t size = graph.size();
+        const size_t registerCount = static_cast<size_t>(1) << log2m;
+        // the counter of a node at t hops is in current, and the one at t + 1 hops is built in next
+        std::vector<uint8_t> current(size * registerCount, 0);
+        parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+            const uint64_t hash = mix(node);
+            const uint64_t rest = hash << log2m;
+            current[node * registerCount + (hash >> (64 - log2m))] = rest == 0 ? 64 - log2m + 1 : std::countl_zero(rest) + 1;
+        });
+        std::vector<uint8_t> next(current);
+
+        Balls balls{std::vector<double>(size, 0.0), std::vector<double>(size, 0.0), std::vector<double>(size, 0.0)};
+        parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+            balls.sizes[node] = estimateSize(current.data() + node * registerCount, registerCount);
+        });
+        std::vector<uint8_t> isChanged(size, 1);
+        std::vector<uint8_t> isNextChanged(size, 0);
+        size_t changedCount = size;
+        int distance = 0;
+        while (changedCount > 0) {
+            distance++;
+            parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+                isNextChanged[node] = 0;
+                const auto adjacents = graph.getAdjacents(node);
+                if (std::none_of(adjacents.begin(), adjacents.end(), [&](int adjacent) { return isChanged[adjacent]; })) {
+                    return;
+                }
+                uint8_t *target = next.data() + node * registerCount;
+                for (const int adjacent : adjacents) {
+                    const uint8_t *source = current.data() + adjacent * registerCount;
+                    for (size_t i = 0; i < registerCount; i++) {
+                        target[i] = std::max(target[i], source[i]);
+                    }
+                }
+                if (std::equal(target, target + registerCount, current.data() + node * registerCount)) {
+                    return;
+                }
+                isNextChanged[node] = 1;
+                const double grown = std::max(0.0, estimateSize(target, registerCount) - balls.sizes[node]);
+                balls.harmonics[node] += grown / distance;
+                balls.distanceSums[node] += grown * distance;
+                balls.sizes[node] += grown;
+            });
+            parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+                if (isNextChanged[node]) {
+                    std::copy_n(next.data() + node * registerCount, registerCount, current.data() + node * registerCount);
+                }
+            });
+            changedCount = std::count(isNextChanged.begin(), isNextChanged.end(), 1);
+            std::swap(isChanged, isNextChanged);
+        }
+        spdlog::debug("HyperBall converged in {} passes with {} registers per node", distance, registerCount);
+        return balls;
+    }
+}
+
+namespace anagraph {
+namespace centrality {
+
+std::vector<double> betweenness(const graph_structure::Graph &graph) {
+    return betweenness(graph, 1);
+}
+
+std::vector<double> betweenness(const graph_structure::Graph &graph, int numThreads) {
+    return betweenness(graph_structure::CompressedGraph(graph), true, numThreads);
+}
+
+std::vector<double> betweenness(const graph_structure::Digraph &graph) {
+    return betweenness(graph, 1);
+}
+
+std::vector<double> betweenness(const graph_structure::Digraph &graph, int numThreads) {
+    return betweenness(graph_structure::CompressedGraph(graph), false, numThreads);
+}
+
+std::vector<double> betweenness(const graph_structure::WeightedGraph &graph) {
+    return betweenness(graph, 1);
+}
+
+std::vector<double> betweenness(const graph_structure::WeightedGraph &graph, int numThreads) {
+    return betweenness(graph_structure::CompressedGraph(graph), true, numThreads);
+}
+
+std::vector<double> betweenness(const graph_structure::WeightedDigraph &graph) {
+    return betweenness(graph, 1);
+}
+
+std::vector<double> betweenness(const graph_structure::WeightedDigraph &graph, int numThreads) {
+    return betweenness(graph_structure::CompressedGraph(graph), false, numThreads);
+}
+
+std::vector<double> betweenness(const graph_structure::CompressedGraph &graph, bool isUndirected, int numThreads) {
+    const bool isUnit = isUnitWeighted(graph);
+    std::vector<int> sources(graph.size());
+    for (size_t node = 0; node < graph.size(); node++) {
+        sources[node] = node;
+    }
+    spdlog::debug("accumulating the dependencies from all {} sources by {}", sources.size(), isUnit ? "BFS" : "Dijkstra");
+    return accumulateSources(graph, isUnit, sources, isUndirected ? 0.5 : 1.0, numThreads);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::Graph &graph, double epsilon, double delta) {
+    return estimateBetweenness(graph, epsilon, delta, 1);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::Graph &graph, double epsilon, double delta, int numThreads) {
+    return estimateBetweenness(graph_structure::CompressedGraph(graph), true, epsilon, delta, numThreads);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::Digraph &graph, double epsilon, double delta) {
+    return estimateBetweenness(graph, epsilon, delta, 1);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::Digraph &graph, double epsilon, double delta, int numThreads) {
+    return estimateBetweenness(graph_structure::CompressedGraph(graph), false, epsilon, delta, numThreads);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::WeightedGraph &graph, double epsilon, double delta) {
+    return estimateBetweenness(graph, epsilon, delta, 1);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::WeightedGraph &graph, double epsilon, double delta, int numThreads) {
+    return estimateBetweenness(graph_structure::CompressedGraph(graph), true, epsilon, delta, numThreads);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::WeightedDigraph &graph, double epsilon, double delta) {
+    return estimateBetweenness(graph, epsilon, delta, 1);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::WeightedDigraph &graph, double epsilon, double delta, int numThreads) {
+    return estimateBetweenness(graph_structure::CompressedGraph(graph), false, epsilon, delta, numThreads);
+}
+
+std::vector<double> estimateBetweenness(const graph_structure::CompressedGraph &graph, bool isUndirected, double epsilon, double delta, int numThreads) {
+    if (!(epsilon > 0 && epsilon < 1)) {
+        throw std::invalid_argument("epsilon must be in (0, 1)");
+    }
+    if (!(delta > 0 && delta < 1)) {
+        throw std::invalid_argument("delta must be in (0, 1)");
+    }
+    const size_t size = graph.size();
+    const double sampleCount = std::ceil(std::log(2.0 * size / delta) / (2 * epsilon * epsilon));
+    if (size == 0 || sampleCount >= size) {
+        return betweenness(graph, isUndirected, numThreads);
+    }
+
+    const bool isUnit = isUnitWeighted(graph);
+    std::vector<int> sources(static_cast<size_t>(sampleCount));
+    std::mt19937_64 engine(SAMPLE_SEED);
+    std::uniform_int_distribution<int> distribution(0, size - 1);
+    for (int &source : sources) {
+        source = distribution(engine);
+    }
+    spdlog::debug("accumulating the dependencies from {} sampled sources of {}", sources.size(), size);
+    const double scale = static_cast<double>(size) / sources.size() * (isUndirected ? 0.5 : 1.0);
+    return accumulateSources(graph, isUnit, sources, scale, numThreads);
+}
+
+std::vector<double> harmonicCentrality(const graph_structure::Graph &graph) {
+    return harmonicCentrality(graph, 1);
+}
+
+std::vector<double> harmonicCentrality(const graph_structure::Graph &graph, int numThreads) {
+    return harmonicCentrality(graph_structure::CompressedGraph(graph), DEFAULT_LOG2M, numThreads);
+}
+
+std::vector<double> harmonicCentrality(const graph_structure::Digraph &graph) {
+    return harmonicCentrality(graph, 1);
+}
+
+std::vector<double> harmonicCentrality(const graph_structure::Digraph &graph, int numThreads) {
+    return harmonicCentrality(graph_structure::CompressedGraph(graph), DEFAULT_LOG2M, numThreads);
+}
+
+std::vector<double> harmonicCentrality(const graph_structure::CompressedGraph &graph, int log2m, int numThreads) {
+    return hyperBall(graph, log2m, numThreads).harmonics;
+}
+
+std::vector<double> closenessCentrality(const graph_structure::Graph &graph) {
+    return closenessCentrality(graph, 1);
+}
+
+std::vector<double> closenessCentrality(const graph_structure::Graph &graph, int numThreads) {
+    return closenessCentrality(graph_structure::CompressedGraph(graph), DEFAULT_LOG2M, numThreads);
+}
+
+std::vector<double> closenessCentrality(const graph_structure::Digraph &graph) {
+    return closenessCentrality(graph, 1);
+}
+
+std::vector<double> closenessCentrality(const graph_structure::Digraph &graph, int numThreads) {
+    return closenessCentrality(graph_structure::CompressedGraph(graph), DEFAULT_LOG2M, numThreads);
+}
+
+std::vector<double> closenessCentrality(const graph_structure::CompressedGraph &graph, int log2m, int numThreads) {
+    const Balls balls = hyperBall(graph, log2m, numThreads);
+    std::vector<double> closeness(graph.size(), 0.0);
+    for (size_t node = 0; node < graph.size(); node++) {
+        if (balls.distanceSums[node] > 0) {
+            closeness[node] = (balls.sizes[node] - 1) / balls.distanceSums[node];
+        }
+    }
+    return closeness;
+}
+
+} // namespace centrality
+} // namespace anagraph
\ No newline at end of file
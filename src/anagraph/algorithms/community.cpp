@@ -0,0 +1,664 @@
+#include "anagraph/algorithms/community.hpp"
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    constexpr double DEFAULT_RESOLUTION = 1.0;
+    constexpr double DEFAULT_THRESHOLD = 0.001;
+    constexpr uint64_t DEFAULT_SEED = 3141592653;
+    constexpr size_t MAX_ITERATIONS = 100;
+    constexpr size_t BATCHES = 8;
+    constexpr size_t MAX_ROUNDS = 32;
+    // the gain relative to the degree of the moved node, below which the move is regarded as a tie
+    constexpr double MIN_GAIN = 1e-12;
+
+    uint64_t mix(uint64_t x) {
+        // splitmix64
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @struct LevelGraph
+     * @brief The graph of a level, whose self-loops are kept apart from the other edges.
+     */
+    struct LevelGraph {
+        std::vector<size_t> offsets;
+        std::vector<int> targets;
+        std::vector<double> weights;
+        std::vector<double> selfLoops;
+        std::vector<double> strengths; /**< The weighted degree, counting the self-loop twice */
+        double totalStrength = 0.0;
+
+        size_t size() const {
+            return strengths.size();
+        }
+
+        std::span<const int> getAdjacents(size_t node) const {
+            return std::span<const int>(targets.data() + offsets[node], offsets[node + 1] - offsets[node]);
+        }
+
+        std::span<const double> getWeights(size_t node) const {
+            return std::span<const double>(weights.data() + offsets[node], offsets[node + 1] - offsets[node]);
+        }
+    };
+
+    LevelGraph toLevelGraph(const CompressedGraph &graph) {
+        const size_t size = graph.size();
+        LevelGraph level;
+        level.offsets.resize(size + 1, 0);
+        level.selfLoops.resize(size, 0.0);
+        level.strengths.resize(size, 0.0);
+        for (size_t node = 0; node < size; node++) {
+            const auto adjacents = graph.getAdjacents(node);
+            const auto weights = graph.getWeights(node);
+            for (size_t e = 0; e < adjacents.size(); e++) {
+                if (weights[e] < 0) {
+                    throw std::invalid_argument("Weights must not be negative");
+                }
+                if (adjacents[e] == static_cast<int>(node)) {
+                    level.selfLoops[node] += weights[e];
+                    continue;
+                }
+                level.targets.push_back(adjacents[e]);
+                level.weights.push_back(weights[e]);
+                level.strengths[node] += weights[e];
+            }
+            level.offsets[node + 1] = level.targets.size();
+            level.strengths[node] += 2 * level.selfLoops[node];
+            level.totalStrength += level.strengths[node];
+        }
+        return level;
+    }
+
+    /**
+     * @class Accumulator
+     * @brief The sum of the weights for each key, cleared in the time of the touched keys.
+     */
+    class Accumulator {
+    private:
+        std::vector<double> sums;
+        std::vector<bool> isTouched;
+        std::vector<int> touched;
+
+    public:
+        explicit Accumulator(size_t size) : sums(size, 0.0), isTouched(size, false) {}
+
+        void add(int key, double weight) {
+            if (!isTouched[key]) {
+                isTouched[key] = true;
+                touched.push_back(key);
+            }
+            sums[key] += weight;
+        }
+
+        double get(int key) const {
+            return sums[key];
+        }
+
+        const std::vector<int>& getTouched() const {
+            return touched;
+        }
+
+        void clear() {
+            for (const int key : touched) {
+                sums[key] = 0.0;
+                isTouched[key] = false;
+            }
+            touched.clear();
+        }
+    };
+
+    /**
+     * @brief Relabel the labels to [0, count) in the order of their first nodes.
+     * @return The number of the labels
+     */
+    size_t densify(std::vector<int> &labels) {
+        std::unordered_map<int, int> dense;
+        for (int &label : labels) {
+            label = dense.try_emplace(label, dense.size()).first->second;
+        }
+        return dense.size();
+    }
+
+    /**
+     * @brief Group the nodes by their dense labels.
+     */
+    std::vector<std::vector<int>> groupMembers(const std::vector<int> &labels, size_t count) {
+        std::vector<std::vector<int>> members(count);
+        for (size_t node = 0; node < labels.size(); node++) {
+            members[labels[node]].push_back(node);
+        }
+        return members;
+    }
+
+    /**
+     * @brief Choose the community of a node with the largest modularity gain.
+     * @param scale resolution / 2m
+     */
+    int chooseCommunity(const LevelGraph &graph, const std::vector<int> &labels, const std::vector<double> &totals, const std::vector<size_t> &counts, int node, double scale, Accumulator &accumulator) {
+        const auto adjacents = graph.getAdjacents(node);
+        const auto weights = graph.getWeights(node);
+        for (size_t e = 0; e < adjacents.size(); e++) {
+            accumulator.add(labels[adjacents[e]], weights[e]);
+        }
+        const int current = labels[node];
+        const double strength = graph.strengths[node];
+        const double tolerance = MIN_GAIN * strength;
+        int best = current;
+        double bestGain = accumulator.get(current) - scale * strength * (totals[current] - strength);
+        for (const int community : accumulator.getTouched()) {
+            const double gain = accumulator.get(community) - scale * strength * totals[community];
+            if (community != current && gain > bestGain + tolerance) {
+                best = community;
+                bestGain = gain;
+            }
+        }
+        accumulator.clear();
+        // two singletons would swap with each other forever if moved at once, so only the larger one moves
+        if (counts[current] == 1 && counts[best] == 1 && best > current) {
+            return current;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Move the nodes to the adjacent communities until no node moves.
+     * @param labels The community of each node, updated in place
+     * @return The number of the moves
+     */
+    size_t moveNodes(const LevelGraph &graph, std::vector<int> &labels, double resolution, int numThreads, std::vector<Accumulator> &accumulators) {
+        const size_t size = graph.size();
+        if (graph.totalStrength == 0) {
+            return 0;
+        }
+        const double scale = resolution / graph.totalStrength;
+        std::vector<double> totals(size, 0.0);
+        std::vector<size_t> counts(size, 0);
+        std::vector<std::vector<int>> batches(BATCHES);
+        for (size_t node = 0; node < size; node++) {
+            totals[labels[node]] += graph.strengths[node];
+            counts[labels[node]]++;
+            batches[mix(node) % BATCHES].push_back(node);
+        }
+
+        size_t moves = 0;
+        std::vector<int> choices;
+        for (size_t round = 0; round < MAX_ROUNDS; round++) {
+            size_t roundMoves = 0;
+            for (const auto &batch : batches) {
+                if (batch.empty()) {
+                    continue;
+                }
+                // the nodes of a batch choose against the same communities, and then move in order
+                choices.resize(batch.size());
+                const size_t blocks = std::min(accumulators.size(), batch.size());
+                const size_t blockSize = (batch.size() + blocks - 1) / blocks;
+                parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+                    const size_t blockEnd = std::min(batch.size(), (block + 1) * blockSize);
+                    for (size_t i = block * blockSize; i < blockEnd; i++) {
+                        choices[i] = chooseCommunity(graph, labels, totals, counts, batch[i], scale, accumulators[block]);
+                    }
+                });
+                for (size_t i = 0; i < batch.size(); i++) {
+                    const int node = batch[i];
+                    const int current = labels[node];
+                    if (choices[i] == current) {
+                        continue;
+                    }
+                    totals[current] -= graph.strengths[node];
+                    counts[current]--;
+                    totals[choices[i]] += graph.strengths[node];
+                    counts[choices[i]]++;
+                    labels[node] = choices[i];
+                    roundMoves++;
+                }
+            }
+            moves += roundMoves;
+            if (roundMoves == 0) {
+                break;
+            }
+        }
+        return moves;
+    }
+
+    /**
+     * @brief Refine each community into the well-connected sub-communities.
+     * @param labels The dense community of each node
+     * @param count The number of the communities
+     * @return The sub-community of each node, labeled by a node in it
+     */
+    std::vector<int> refine(const LevelGraph &graph, const std::vector<int> &labels, size_t count, double resolution, int numThreads, std::vector<Accumulator> &accumulators) {
+        const size_t size = graph.size();
+        std::vector<int> refined(size);
+        std::iota(refined.begin(), refined.end(), 0);
+        if (graph.totalStrength == 0) {
+            return refined;
+        }
+        const double scale = resolution / graph.totalStrength;
+        const std::vector<std::vector<int>> members = groupMembers(labels, count);
+        std::vector<double> internals(size, 0.0); /**< The weight from each node to the rest of its community */
+        std::vector<double> subTotals(graph.strengths);
+        std::vector<double> subExternals(size, 0.0); /**< The weight from each sub-community to the rest of its community */
+        std::vector<size_t> subCounts(size, 1);
+
+        // each community is refined by one thread, touching only the entries of its own nodes
+        const size_t blocks = std::min(accumulators.size(), count);
+        const size_t blockSize = (count + blocks - 1) / blocks;
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            const size_t blockEnd = std::min(count, (block + 1) * blockSize);
+            for (size_t community = block * blockSize; community < blockEnd; community++) {
+                double communityTotal = 0.0;
+                for (const int node : members[community]) {
+                    communityTotal += graph.strengths[node];
+                    const auto adjacents = graph.getAdjacents(node);
+                    const auto weights = graph.getWeights(node);
+                    for (size_t e = 0; e < adjacents.size(); e++) {
+                        if (labels[adjacents[e]] == static_cast<int>(community)) {
+                            internals[node] += weights[e];
+                        }
+                    }
+                    subExternals[node] = internals[node];
+                }
+
+                Accumulator &accumulator = accumulators[block];
+                for (const int node : members[community]) {
+                    const double strength = graph.strengths[node];
+                    // only a singleton well connected to its community is merged
+                    if (subCounts[node] != 1 || internals[node] < scale * strength * (communityTotal - strength)) {
+                        continue;
+                    }
+                    const auto adjacents = graph.getAdjacents(node);
+                    const auto weights = graph.getWeights(node);
+                    for (size_t e = 0; e < adjacents.size(); e++) {
+                        if (labels[adjacents[e]] == static_cast<int>(community)) {
+                            accumulator.add(refined[adjacents[e]], weights[e]);
+                        }
+                    }
+                    int best = node;
+                    double bestGain = MIN_GAIN * strength;
+                    for (const int subCommunity : accumulator.getTouched()) {
+                        const double subTotal = subTotals[subCommunity];
+                        if (subCommunity == node || subExternals[subCommunity] < scale * subTotal * (communityTotal - subTotal)) {
+                            continue;
+                        }
+                        const double gain = accumulator.get(subCommunity) - scale * strength * subTotal;
+                        if (gain > bestGain) {
+                            best = subCommunity;
+                            bestGain = gain;
+                        }
+                    }
+                    if (best != node) {
+                        subExternals[best] += internals[node] - 2 * accumulator.get(best);
+                        subTotals[best] += strength;
+                        subCounts[best]++;
+                        subCounts[node] = 0;
+                        refined[node] = best;
+                    }
+                    accumulator.clear();
+                }
+            }
+        });
+        return refined;
+    }
+
+    /**
+     * @brief Aggregate the nodes of each group into a node of the next level.
+     * @param labels The dense group of each node
+     * @param count The number of the groups
+     */
+    LevelGraph aggregate(const LevelGraph &graph, const std::vector<int> &labels, size_t count, int numThreads, std::vector<Accumulator> &accumulators) {
+        const std::vector<std::vector<int>> members = groupMembers(labels, count);
+        LevelGraph next;
+        next.selfLoops.resize(count, 0.0);
+        next.strengths.resize(count, 0.0);
+        next.totalStrength = graph.totalStrength;
+        std::vector<std::vector<std::pair<int, double>>> edges(count);
+
+        const size_t blocks = std::min(accumulators.size(), count);
+        const size_t blockSize = (count + blocks - 1) / blocks;
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            Accumulator &accumulator = accumulators[block];
+            const size_t blockEnd = std::min(count, (block + 1) * blockSize);
+            for (size_t group = block * blockSize; group < blockEnd; group++) {
+                for (const int node : members[group]) {
+                    next.selfLoops[group] += graph.selfLoops[node];
+                    next.strengths[group] += graph.strengths[node];
+                    const auto adjacents = graph.getAdjacents(node);
+                    const auto weights = graph.getWeights(node);
+                    for (size_t e = 0; e < adjacents.size(); e++) {
+                        const int adjacentGroup = labels[adjacents[e]];
+                        if (adjacentGroup == static_cast<int>(group)) {
+                            // an edge inside the group is seen from both ends
+                            next.selfLoops[group] += weights[e] / 2;
+                        } else {
+                            accumulator.add(adjacentGroup, weights[e]);
+                        }
+                    }
+                }
+                for (const int adjacentGroup : accumulator.getTouched()) {
+                    edges[group].emplace_back(adjacentGroup, accumulator.get(adjacentGroup));
+                }
+                std::sort(edges[group].begin(), edges[group].end());
+                accumulator.clear();
+            }
+        });
+
+        next.offsets.resize(count + 1, 0);
+        for (size_t group = 0; group < count; group++) {
+            for (const auto &[adjacentGroup, weight] : edges[group]) {
+                next.targets.push_back(adjacentGroup);
+                next.weights.push_back(weight);
+            }
+            next.offsets[group + 1] = next.targets.size();
+        }
+        return next;
+    }
+
+    /**
+     * @brief Merge the supernodes of each group of a level in the supergraph.
+     * @param levelIds The id in the supergraph of each node of the level
+     * @return The id in the supergraph of each node of the next level
+     */
+    std::vector<int> mergeLevel(graph_structure::WeightedSupergraph &summary, const std::vector<int> &levelIds, const std::vector<int> &labels, size_t count) {
+        std::vector<int> firsts(count, -1);
+        std::vector<std::pair<int, int>> pairs;
+        for (size_t node = 0; node < labels.size(); node++) {
+            int &first = firsts[labels[node]];
+            if (first == -1) {
+                first = node;
+            } else {
+                pairs.emplace_back(levelIds[first], levelIds[node]);
+            }
+        }
+        const std::unordered_map<int, int> merged = summary.mergeNodes(pairs);
+        std::vector<int> nextIds(count);
+        for (size_t group = 0; group < count; group++) {
+            const int id = levelIds[firsts[group]];
+            const auto it = merged.find(id);
+            nextIds[group] = it != merged.end() ? it->second : id;
+        }
+        return nextIds;
+    }
+
+    /**
+     * @brief Create the supergraph whose leaves are the nodes and edges of the graph.
+     */
+    graph_structure::WeightedSupergraph toLeaves(const graph_structure::WeightedGraph &graph) {
+        graph_structure::WeightedSupergraph summary;
+        for (const int id : graph.getIdRange()) {
+            summary.setNode(id);
+        }
+        for (const auto &[src, dst, weight] : graph.getEdges(true)) {
+            summary.setEdge(src, dst, weight);
+        }
+        return summary;
+    }
+
+    std::vector<int> toIds(const CompressedGraph &graph) {
+        std::vector<int> ids(graph.size());
+        for (size_t i = 0; i < graph.size(); i++) {
+            ids[i] = graph.getId(i);
+        }
+        return ids;
+    }
+
+    graph_structure::WeightedSupergraph detectCommunities(const graph_structure::WeightedGraph &graph, double resolution, int numThreads, bool isRefined) {
+        if (!(resolution > 0)) {
+            throw std::invalid_argument("resolution must be positive");
+        }
+        const int threads = std::max(1, numThreads);
+        const CompressedGraph compressed(graph);
+        LevelGraph level = toLevelGraph(compressed);
+        graph_structure::WeightedSupergraph summary = toLeaves(graph);
+        std::vector<int> levelIds = toIds(compressed);
+        std::vector<int> labels(level.size());
+        std::iota(labels.begin(), labels.end(), 0);
+        std::vector<Accumulator> accumulators(threads, Accumulator(level.size()));
+        for (int depth = 1; level.size() > 0; depth++) {
+            const size_t moves = moveNodes(level, labels, resolution, threads, accumulators);
+            const size_t communityCount = densify(labels);
+            if (communityCount == level.size()) {
+                break;
+            }
+
+            // the refined sub-communities are aggregated instead, unless no node is merged in the refinement
+            std::vector<int> groups = labels;
+            size_t groupCount = communityCount;
+            if (isRefined) {
+                std::vector<int> refined = refine(level, labels, communityCount, resolution, threads, accumulators);
+                const size_t refinedCount = densify(refined);
+                if (refinedCount < level.size()) {
+                    groups = std::move(refined);
+                    groupCount = refinedCount;
+                }
+            }
+
+            levelIds = mergeLevel(summary, levelIds, groups, groupCount);
+            std::vector<int> nextLabels(groupCount);
+            for (size_t node = 0; node < level.size(); node++) {
+                nextLabels[groups[node]] = labels[node];
+            }
+            level = aggregate(level, groups, groupCount, threads, accumulators);
+            labels = std::move(nextLabels);
+            spdlog::debug("level {}: {} moves, {} communities, {} aggregated nodes", depth, moves, communityCount, groupCount);
+        }
+        return summary;
+    }
+
+    /**
+     * @brief Choose the label of the largest total weight among the neighbors of a node.
+     * @param loadLabel The function to read the label of a node
+     */
+    template <typename LoadLabel>
+    int chooseLabel(const LevelGraph &graph, int node, int current, LoadLabel &&loadLabel, Accumulator &accumulator) {
+        const auto adjacents = graph.getAdjacents(node);
+        const auto weights = graph.getWeights(node);
+        for (size_t e = 0; e < adjacents.size(); e++) {
+            accumulator.add(loadLabel(adjacents[e]), weights[e]);
+        }
+        double maxWeight = 0.0;
+        for (const int label : accumulator.getTouched()) {
+            maxWeight = std::max(maxWeight, accumulator.get(label));
+        }
+        // keep the current label on a tie, so that the labels settle
+        int best = current;
+        if (accumulator.get(current) < maxWeight) {
+            best = std::numeric_limits<int>::max();
+            for (const int label : accumulator.getTouched()) {
+                if (accumulator.get(label) == maxWeight) {
+                    best = std::min(best, label);
+                }
+            }
+        }
+        accumulator.clear();
+        return best;
+    }
+
+    /**
+     * @brief Update the labels in place by the threads, each over a contiguous block of the nodes.
+     * @return The number of the changed nodes
+     */
+    size_t propagateAsync(const LevelGraph &graph, std::vector<int> &labels, int numThreads, std::vector<Accumulator> &accumulators) {
+        const size_t size = graph.size();
+        const size_t blocks = std::min(accumulators.size(), size);
+        const size_t blockSize = (size + blocks - 1) / blocks;
+        std::vector<size_t> changedCounts(blocks, 0);
+        auto loadLabel = [&](int node) {
+            return std::atomic_ref<int>(labels[node]).load(std::memory_order_relaxed);
+        };
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            const size_t blockEnd = std::min(size, (block + 1) * blockSize);
+            for (size_t node = block * blockSize; node < blockEnd; node++) {
+                const int current = loadLabel(node);
+                const int label = chooseLabel(graph, node, current, loadLabel, accumulators[block]);
+                if (label != current) {
+                    std::atomic_ref<int>(labels[node]).store(label, std::memory_order_relaxed);
+                    changedCounts[block]++;
+                }
+            }
+        });
+        return std::reduce(changedCounts.begin(), changedCounts.end());
+    }
+
+    /**
+     * @brief Update the labels in batches of the order, each batch choosing against the labels after the previous one.
+     * @return The number of the changed nodes
+     */
+    size_t propagateInBatches(const LevelGraph &graph, std::vector<int> &labels, const std::vector<int> &order, int numThreads, std::vector<Accumulator> &accumulators) {
+        const size_t size = graph.size();
+        size_t changedCount = 0;
+        std::vector<int> choices;
+        auto loadLabel = [&](int node) {
+            return labels[node];
+        };
+        for (size_t batch = 0; batch < BATCHES; batch++) {
+            const size_t batchBegin = size * batch / BATCHES;
+            const size_t batchSize = size * (batch + 1) / BATCHES - batchBegin;
+            if (batchSize == 0) {
+                continue;
+            }
+            choices.resize(batchSize);
+            const size_t blocks = std::min(accumulators.size(), batchSize);
+            const size_t blockSize = (batchSize + blocks - 1) / blocks;
+            parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+                const size_t blockEnd = std::min(batchSize, (block + 1) * blockSize);
+                for (size_t i = block * blockSize; i < blockEnd; i++) {
+                    const int node = order[batchBegin + i];
+                    choices[i] = chooseLabel(graph, node, labels[node], loadLabel, accumulators[block]);
+                }
+            });
+            for (size_t i = 0; i < batchSize; i++) {
+                int &label = labels[order[batchBegin + i]];
+                changedCount += label != choices[i] ? 1 : 0;
+                label = choices[i];
+            }
+        }
+        return changedCount;
+    }
+
+    graph_structure::WeightedSupergraph propagateLabels(const graph_structure::WeightedGraph &graph, double threshold, int numThreads, std::optional<uint64_t> seed) {
+        if (!(threshold >= 0 && threshold <= 1)) {
+            throw std::invalid_argument("threshold must be in [0, 1]");
+        }
+        const int threads = std::max(1, numThreads);
+        const CompressedGraph compressed(graph);
+        const LevelGraph level = toLevelGraph(compressed);
+        const size_t size = level.size();
+        std::vector<int> labels(size);
+        std::iota(labels.begin(), labels.end(), 0);
+        std::vector<int> order(labels);
+        std::mt19937_64 engine(seed.value_or(DEFAULT_SEED));
+        std::vector<Accumulator> accumulators(threads, Accumulator(size));
+
+        size_t iteration = 0;
+        while (size > 0 && iteration < MAX_ITERATIONS) {
+            iteration++;
+            size_t changedCount;
+            if (seed.has_value()) {
+                std::shuffle(order.begin(), order.end(), engine);
+                changedCount = propagateInBatches(level, labels, order, threads, accumulators);
+            } else {
+                changedCount = propagateAsync(level, labels, threads, accumulators);
+            }
+            spdlog::debug("label propagation iteration {}: {} of {} nodes changed", iteration, changedCount, size);
+            if (changedCount <= threshold * size) {
+                break;
+            }
+        }
+
+        graph_structure::WeightedSupergraph summary = toLeaves(graph);
+        const size_t labelCount = densify(labels);
+        if (labelCount < size) {
+            mergeLevel(summary, toIds(compressed), labels, labelCount);
+        }
+        return summary;
+    }
+}
+
+namespace anagraph {
+namespace community {
+
+graph_structure::WeightedSupergraph louvain(const graph_structure::WeightedGraph &graph) {
+    return louvain(graph, DEFAULT_RESOLUTION, 1);
+}
+
+graph_structure::WeightedSupergraph louvain(const graph_structure::WeightedGraph &graph, double resolution, int numThreads) {
+    return detectCommunities(graph, resolution, numThreads, false);
+}
+
+graph_structure::WeightedSupergraph leiden(const graph_structure::WeightedGraph &graph) {
+    return leiden(graph, DEFAULT_RESOLUTION, 1);
+}
+
+graph_structure::WeightedSupergraph leiden(const graph_structure::WeightedGraph &graph, double resolution, int numThreads) {
+    return detectCommunities(graph, resolution, numThreads, true);
+}
+
+graph_structure::WeightedSupergraph labelPropagation(const graph_structure::WeightedGraph &graph) {
+    return labelPropagation(graph, DEFAULT_THRESHOLD, 1, DEFAULT_SEED);
+}
+
+graph_structure::WeightedSupergraph labelPropagation(const graph_structure::WeightedGraph &graph, double threshold, int numThreads) {
+    return propagateLabels(graph, threshold, numThreads, std::nullopt);
+}
+
+graph_structure::WeightedSupergraph labelPropagation(const graph_structure::WeightedGraph &graph, double threshold, int numThreads, uint64_t seed) {
+    return propagateLabels(graph, threshold, numThreads, seed);
+}
+
+double modularity(const graph_structure::WeightedGraph &graph, const std::vector<int> &communities) {
+    return modularity(graph, communities, DEFAULT_RESOLUTION);
+}
+
+double modularity(const graph_structure::WeightedGraph &graph, const std::vector<int> &communities, double resolution) {
+    const LevelGraph level = toLevelGraph(graph_structure::CompressedGraph(graph));
+    if (communities.size() != level.size()) {
+        throw std::invalid_argument("The size of communities does not match the graph");
+    }
+    if (level.totalStrength == 0) {
+        return 0.0;
+    }
+    // the internal weight and the total degree of each community
+    std::unordered_map<int, std::pair<double, double>> sums;
+    for (size_t node = 0; node < level.size(); node++) {
+        auto &[internal, total] = sums[communities[node]];
+        internal += 2 * level.selfLoops[node];
+        total += level.strengths[node];
+        const auto adjacents = level.getAdjacents(node);
+        const auto weights = level.getWeights(node);
+        for (size_t e = 0; e < adjacents.size(); e++) {
+            if (communities[adjacents[e]] == communities[node]) {
+                internal += weights[e];
+            }
+        }
+    }
+    double quality = 0.0;
+    for (const auto &[_, sum] : sums) {
+        quality += sum.first - resolution * sum.second * sum.second / level.totalStrength;
+    }
+    return quality / level.totalStrength;
+}
+
+} // namespace community
+} // namespace anagraph
\ No newline at end of file
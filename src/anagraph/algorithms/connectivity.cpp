@@ -0,0 +1,225 @@
+#include "anagraph/algorithms/connectivity.hpp"
+
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    constexpr size_t NEIGHBOR_ROUNDS = 2;
+    constexpr size_t SAMPLE_SIZE = 1024;
+
+    int load(std::vector<int> &components, int index) {
+        return std::atomic_ref<int>(components[index]).load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Unite the components of two nodes, by linking the larger root to the smaller index.
+     */
+    void link(std::vector<int> &components, int first, int second) {
+        int firstParent = load(components, first);
+        int secondParent = load(components, second);
+        while (firstParent != secondParent) {
+            const int high = std::max(firstParent, secondParent);
+            const int low = std::min(firstParent, secondParent);
+            int highParent = load(components, high);
+            if (highParent == low) {
+                break;
+            }
+            if (highParent == high && std::atomic_ref<int>(components[high]).compare_exchange_strong(highParent, low, std::memory_order_relaxed)) {
+                break;
+            }
+            // another thread has linked high, so follow the new parents
+            firstParent = load(components, load(components, high));
+            secondParent = load(components, low);
+        }
+    }
+
+    /**
+     * @brief Point every node directly to its root.
+     */
+    void compress(std::vector<int> &components, int numThreads) {
+        parallel::parallelFor(0, components.size(), numThreads, [&](size_t node) {
+            int parent = load(components, node);
+            while (parent != load(components, parent)) {
+                parent = load(components, parent);
+            }
+            std::atomic_ref<int>(components[node]).store(parent, std::memory_order_relaxed);
+        });
+    }
+
+    /**
+     * @brief Estimate the most frequent component from sampled nodes.
+     */
+    int sampleFrequentComponent(std::vector<int> &components) {
+        std::mt19937 engine(27491095);
+        std::uniform_int_distribution<size_t> distribution(0, components.size() - 1);
+        std::unordered_map<int, size_t> counts;
+        for (size_t i = 0; i < SAMPLE_SIZE; i++) {
+            counts[components[distribution(engine)]]++;
+        }
+        const auto frequent = std::max_element(counts.begin(), counts.end(), [](const auto &a, const auto &b) {
+            return a.second < b.second || (a.second == b.second && a.first > b.first);
+        });
+        return frequent->first;
+    }
+
+    std::vector<int> toLabels(const CompressedGraph &graph, const std::vector<int> &components) {
+        std::vector<int> labels(components.size());
+        for (size_t i = 0; i < components.size(); i++) {
+            labels[i] = graph.getId(components[i]);
+        }
+        return labels;
+    }
+}
+
+namespace anagraph {
+namespace connectivity {
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::Graph &graph) {
+    return weaklyConnectedComponents(graph, 1);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::Graph &graph, int numThreads) {
+    return weaklyConnectedComponents(graph_structure::CompressedGraph(graph), true, numThreads);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedGraph &graph) {
+    return weaklyConnectedComponents(graph, 1);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedGraph &graph, int numThreads) {
+    return weaklyConnectedComponents(graph_structure::CompressedGraph(graph), true, numThreads);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::Digraph &graph) {
+    return weaklyConnectedComponents(graph, 1);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::Digraph &graph, int numThreads) {
+    return weaklyConnectedComponents(graph_structure::CompressedGraph(graph), false, numThreads);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedDigraph &graph) {
+    return weaklyConnectedComponents(graph, 1);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::WeightedDigraph &graph, int numThreads) {
+    return weaklyConnectedComponents(graph_structure::CompressedGraph(graph), false, numThreads);
+}
+
+std::vector<int> weaklyConnectedComponents(const graph_structure::CompressedGraph &graph, bool isUndirected, int numThreads) {
+    const size_t size = graph.size();
+    const int threads = std::max(1, numThreads);
+    std::vector<int> components(size);
+    std::iota(components.begin(), components.end(), 0);
+    if (size == 0) {
+        return components;
+    }
+
+    // unite the first edges of each node
+    for (size_t round = 0; round < NEIGHBOR_ROUNDS; round++) {
+        parallel::parallelFor(0, size, threads, [&](size_t node) {
+            const auto adjacents = graph.getAdjacents(node);
+            if (round < adjacents.size()) {
+                link(components, node, adjacents[round]);
+            }
+        });
+        compress(components, threads);
+    }
+
+    // the nodes already in the largest component need not unite the rest of their edges, if every edge is seen from both ends
+    const int frequent = isUndirected ? sampleFrequentComponent(components) : -1;
+    parallel::parallelFor(0, size, threads, [&](size_t node) {
+        if (load(components, node) == frequent) {
+            return;
+        }
+        const auto adjacents = graph.getAdjacents(node);
+        for (size_t e = NEIGHBOR_ROUNDS; e < adjacents.size(); e++) {
+            link(components, node, adjacents[e]);
+        }
+    });
+    compress(components, threads);
+    spdlog::debug("united {} nodes, skipping the component of {}", size, frequent);
+    return toLabels(graph, components);
+}
+
+std::vector<int> stronglyConnectedComponents(const graph_structure::Digraph &graph) {
+    return stronglyConnectedComponents(graph_structure::CompressedGraph(graph));
+}
+
+std::vector<int> stronglyConnectedComponents(const graph_structure::WeightedDigraph &graph) {
+    return stronglyConnectedComponents(graph_structure::CompressedGraph(graph));
+}
+
+std::vector<int> stronglyConnectedComponents(const graph_structure::CompressedGraph &graph) {
+    constexpr int UNVISITED = -1;
+    const size_t size = graph.size();
+    std::vector<int> orders(size, UNVISITED);
+    std::vector<int> lowlinks(size);
+    std::vector<bool> isOnStack(size, false);
+    std::vector<int> stack;
+    std::vector<int> components(size);
+    // the frames of the depth-first search, the node and the position of its next edge
+    std::vector<std::pair<int, size_t>> frames;
+    int order = 0;
+    size_t componentCount = 0;
+
+    auto visit = [&](int node) {
+        orders[node] = lowlinks[node] = order++;
+        stack.push_back(node);
+        isOnStack[node] = true;
+        frames.emplace_back(node, 0);
+    };
+    for (size_t root = 0; root < size; root++) {
+        if (orders[root] != UNVISITED) {
+            continue;
+        }
+        visit(root);
+        while (!frames.empty()) {
+            auto &[node, next] = frames.back();
+            const auto adjacents = graph.getAdjacents(node);
+            if (next < adjacents.size()) {
+                const int adjacent = adjacents[next++];
+                if (orders[adjacent] == UNVISITED) {
+                    visit(adjacent);
+                } else if (isOnStack[adjacent]) {
+                    lowlinks[node] = std::min(lowlinks[node], orders[adjacent]);
+                }
+                continue;
+            }
+
+            const int finished = node;
+            frames.pop_back();
+            if (!frames.empty()) {
+                const int parent = frames.back().first;
+                lowlinks[parent] = std::min(lowlinks[parent], lowlinks[finished]);
+            }
+            if (lowlinks[finished] != orders[finished]) {
+                continue;
+            }
+            // the nodes above finished on the stack form a component
+            const auto begin = std::find(stack.rbegin(), stack.rend(), finished).base() - 1;
+            const int smallest = *std::min_element(begin, stack.end());
+            for (auto it = begin; it != stack.end(); it++) {
+                components[*it] = smallest;
+                isOnStack[*it] = false;
+            }
+            stack.erase(begin, stack.end());
+            componentCount++;
+        }
+    }
+    spdlog::debug("found {} strongly connected components", componentCount);
+    return toLabels(graph, components);
+}
+
+} // namespace connectivity
+} // namespace anagraph
\ No newline at end of file
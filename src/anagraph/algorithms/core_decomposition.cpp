@@ -0,0 +1,266 @@
+#include "anagraph/algorithms/core_decomposition.hpp"
+
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <span>
+#include <stdexcept>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    constexpr int UNASSIGNED = -1;
+
+    /**
+     * @struct Neighbors
+     * @brief The union of the in-neighbors and the out-neighbors of each node, without the node itself.
+     */
+    struct Neighbors {
+        std::vector<size_t> offsets;
+        std::vector<int> targets;
+
+        std::span<const int> getAdjacents(size_t node) const {
+            return std::span<const int>(targets.data() + offsets[node], offsets[node + 1] - offsets[node]);
+        }
+
+        size_t size() const {
+            return offsets.size() - 1;
+        }
+    };
+
+    /**
+     * @brief Merge the sorted out-neighbors and in-neighbors of a node.
+     * @param output The buffer to write the neighbors, or nullptr to only count them
+     * @return The number of the neighbors
+     */
+    size_t mergeNeighbors(const CompressedGraph &graph, const CompressedGraph &transposed, int node, int *output) {
+        const auto outs = graph.getAdjacents(node);
+        const auto ins = transposed.getAdjacents(node);
+        size_t count = 0;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < outs.size() || j < ins.size()) {
+            int next;
+            if (j == ins.size() || (i < outs.size() && outs[i] < ins[j])) {
+                next = outs[i++];
+            } else if (i == outs.size() || ins[j] < outs[i]) {
+                next = ins[j++];
+            } else {
+                next = outs[i++];
+                j++;
+            }
+            if (next == node) {
+                continue;
+            }
+            if (output != nullptr) {
+                output[count] = next;
+            }
+            count++;
+        }
+        return count;
+    }
+
+    Neighbors collectNeighbors(const CompressedGraph &graph, const CompressedGraph &transposed, int numThreads) {
+        if (transposed.size() != graph.size() || transposed.edgeSize() != graph.edgeSize()) {
+            throw std::invalid_argument("The transposed graph does not match the graph");
+        }
+        const size_t size = graph.size();
+        Neighbors neighbors;
+        neighbors.offsets.resize(size + 1, 0);
+        parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+            neighbors.offsets[node + 1] = mergeNeighbors(graph, transposed, node, nullptr);
+        });
+        for (size_t node = 0; node < size; node++) {
+            neighbors.offsets[node + 1] += neighbors.offsets[node];
+        }
+        neighbors.targets.resize(neighbors.offsets[size]);
+        parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+            mergeNeighbors(graph, transposed, node, neighbors.targets.data() + neighbors.offsets[node]);
+        });
+        return neighbors;
+    }
+
+    /**
+     * @brief Collect the nodes satisfying a predicate in parallel.
+     */
+    template <typename Predicate>
+    std::vector<int> collectNodes(size_t begin, size_t end, int numThreads, Predicate &&predicate) {
+        const size_t total = end - begin;
+        const size_t blocks = std::max<size_t>(1, std::min(static_cast<size_t>(numThreads), total));
+        const size_t blockSize = (total + blocks - 1) / blocks;
+        std::vector<std::vector<int>> blockNodes(blocks);
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            const size_t blockEnd = std::min(end, begin + (block + 1) * blockSize);
+            for (size_t i = begin + block * blockSize; i < blockEnd; i++) {
+                if (predicate(i)) {
+                    blockNodes[block].push_back(i);
+                }
+            }
+        });
+        std::vector<int> nodes;
+        for (const auto &block : blockNodes) {
+            nodes.insert(nodes.end(), block.begin(), block.end());
+        }
+        return nodes;
+    }
+
+    template <typename GraphType>
+    graph_structure::SubgraphView<GraphType> kCoreHelper(const GraphType &graph, const CompressedGraph &compressed, const CompressedGraph &transposed, int k) {
+        const std::vector<int> cores = core_decomposition::coreNumbers(compressed, transposed);
+        std::vector<int> ids;
+        for (size_t i = 0; i < cores.size(); i++) {
+            if (cores[i] >= k) {
+                ids.push_back(compressed.getId(i));
+            }
+        }
+        spdlog::debug("the {}-core has {} of {} nodes", k, ids.size(), cores.size());
+        return graph_structure::SubgraphView<GraphType>(graph, std::move(ids));
+    }
+}
+
+namespace anagraph {
+namespace core_decomposition {
+
+std::vector<int> coreNumbers(const graph_structure::Graph &graph) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return coreNumbers(compressed, compressed);
+}
+
+std::vector<int> coreNumbers(const graph_structure::Graph &graph, int numThreads) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return coreNumbers(compressed, compressed, numThreads);
+}
+
+std::vector<int> coreNumbers(const graph_structure::Digraph &graph) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return coreNumbers(compressed, compressed.transpose());
+}
+
+std::vector<int> coreNumbers(const graph_structure::Digraph &graph, int numThreads) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return coreNumbers(compressed, compressed.transpose(), numThreads);
+}
+
+std::vector<int> coreNumbers(const graph_structure::CompressedGraph &graph, const graph_structure::CompressedGraph &transposed) {
+    const Neighbors neighbors = collectNeighbors(graph, transposed, 1);
+    const size_t size = neighbors.size();
+    std::vector<int> degrees(size);
+    int maxDegree = 0;
+    for (size_t node = 0; node < size; node++) {
+        degrees[node] = neighbors.getAdjacents(node).size();
+        maxDegree = std::max(maxDegree, degrees[node]);
+    }
+
+    // sort the nodes by their degrees, where starts[d] is the position of the first node of degree d
+    std::vector<size_t> starts(maxDegree + 2, 0);
+    for (const int degree : degrees) {
+        starts[degree + 1]++;
+    }
+    for (int degree = 0; degree <= maxDegree; degree++) {
+        starts[degree + 1] += starts[degree];
+    }
+    std::vector<int> order(size);
+    std::vector<size_t> positions(size);
+    {
+        std::vector<size_t> nexts(starts.begin(), starts.end() - 1);
+        for (size_t node = 0; node < size; node++) {
+            positions[node] = nexts[degrees[node]]++;
+            order[positions[node]] = node;
+        }
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        const int node = order[i];
+        for (const int adjacent : neighbors.getAdjacents(node)) {
+            const int degree = degrees[adjacent];
+            if (degree <= degrees[node]) {
+                continue;
+            }
+            // swap the neighbor with the first node of its bucket, and shrink the bucket from the front
+            const size_t first = starts[degree];
+            const int firstNode = order[first];
+            std::swap(order[positions[adjacent]], order[first]);
+            positions[firstNode] = positions[adjacent];
+            positions[adjacent] = first;
+            starts[degree]++;
+            degrees[adjacent]--;
+        }
+    }
+    return degrees;
+}
+
+std::vector<int> coreNumbers(const graph_structure::CompressedGraph &graph, const graph_structure::CompressedGraph &transposed, int numThreads) {
+    const int threads = std::max(1, numThreads);
+    const Neighbors neighbors = collectNeighbors(graph, transposed, threads);
+    const size_t size = neighbors.size();
+    std::vector<int> degrees(size);
+    parallel::parallelFor(0, size, threads, [&](size_t node) {
+        degrees[node] = neighbors.getAdjacents(node).size();
+    });
+    std::vector<int> cores(size, UNASSIGNED);
+
+    size_t remaining = size;
+    size_t rounds = 0;
+    int k = 0;
+    while (remaining > 0) {
+        // every remaining node has a degree larger than the previous k, so the next k is the smallest degree
+        std::vector<int> frontier = collectNodes(0, size, threads, [&](size_t node) {
+            return cores[node] == UNASSIGNED;
+        });
+        k = degrees[*std::min_element(frontier.begin(), frontier.end(), [&](int a, int b) {
+            return degrees[a] < degrees[b];
+        })];
+        frontier.erase(std::remove_if(frontier.begin(), frontier.end(), [&](int node) {
+            return degrees[node] > k;
+        }), frontier.end());
+
+        while (!frontier.empty()) {
+            parallel::parallelFor(0, frontier.size(), threads, [&](size_t i) {
+                cores[frontier[i]] = k;
+            });
+            remaining -= frontier.size();
+            rounds++;
+
+            // only the thread lowering the degree of a node from k + 1 to k adds the node to the next round
+            const size_t blocks = std::min(static_cast<size_t>(threads), frontier.size());
+            const size_t blockSize = (frontier.size() + blocks - 1) / blocks;
+            std::vector<std::vector<int>> nexts(blocks);
+            parallel::parallelFor(0, blocks, threads, [&](size_t block) {
+                const size_t blockEnd = std::min(frontier.size(), (block + 1) * blockSize);
+                for (size_t i = block * blockSize; i < blockEnd; i++) {
+                    for (const int adjacent : neighbors.getAdjacents(frontier[i])) {
+                        if (cores[adjacent] != UNASSIGNED) {
+                            continue;
+                        }
+                        if (std::atomic_ref<int>(degrees[adjacent]).fetch_sub(1, std::memory_order_relaxed) == k + 1) {
+                            nexts[block].push_back(adjacent);
+                        }
+                    }
+                }
+            });
+            frontier.clear();
+            for (const auto &next : nexts) {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+            }
+        }
+    }
+    spdlog::debug("peeled {} nodes in {} rounds up to the {}-core", size, rounds, k);
+    return cores;
+}
+
+graph_structure::SubgraphView<graph_structure::Graph> kCore(const graph_structure::Graph &graph, int k) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return kCoreHelper(graph, compressed, compressed, k);
+}
+
+graph_structure::SubgraphView<graph_structure::Digraph> kCore(const graph_structure::Digraph &graph, int k) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return kCoreHelper(graph, compressed, compressed.transpose(), k);
+}
+
+} // namespace core_decomposition
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "anagraph/algorithms/decompression.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CorrectionSet;
+    using graph_structure::HierarchyIndex;
+
+    EdgeObject orderedEdge(bool isUndirected, int src, int dst) {
+        return isUndirected && dst < src ? EdgeObject(dst, src) : EdgeObject(src, dst);
+    }
+
+    /**
+     * @brief Call a function for every pair of leaves implied by a superedge, except for the self loops.
+     */
+    template <bool isUndirected, typename Function>
+    void forEachLeafPair(const HierarchyIndex &index, int first, int second, Function func) {
+        const std::span<const int> firstLeaves = index.getLeaves(first);
+        const std::span<const int> secondLeaves = index.getLeaves(second);
+        if (first != second) {
+            for (const int src : firstLeaves) {
+                for (const int dst : secondLeaves) {
+                    func(src, dst);
+                }
+            }
+            return;
+        }
+        for (size_t i = 0; i < firstLeaves.size(); i++) {
+            for (size_t j = isUndirected ? i + 1 : 0; j < firstLeaves.size(); j++) {
+                if (i != j) {
+                    func(firstLeaves[i], firstLeaves[j]);
+                }
+            }
+        }
+    }
+
+    bool isLeaf(const HierarchyIndex &index, int id) {
+        const std::span<const int> leaves = index.getLeaves(id);
+        return leaves.size() == 1 && leaves[0] == id;
+    }
+
+    template <bool isUndirected>
+    void encodePair(const HierarchyIndex &index, int first, int second, std::vector<WeightedEdgeObject> &edges, CorrectionSet &corrections) {
+        const size_t firstSize = index.getLeafCount(first);
+        const size_t secondSize = index.getLeafCount(second);
+        size_t leafPairs = firstSize * secondSize;
+        if (first == second) {
+            leafPairs = isUndirected ? firstSize * (firstSize - 1) / 2 : firstSize * (firstSize - 1);
+        }
+
+        // the superedge implies the most frequent weight, the smaller one on a tie
+        std::map<double, size_t> weightCounts;
+        for (const WeightedEdgeObject &edge : edges) {
+            weightCounts[std::get<2>(edge)]++;
+        }
+        double impliedWeight = 0.0;
+        size_t impliedCount = 0;
+        for (const auto &[weight, count] : weightCounts) {
+            if (count > impliedCount) {
+                impliedWeight = weight;
+                impliedCount = count;
+            }
+        }
+
+        const size_t denseCost = 1 + (leafPairs - edges.size()) + (edges.size() - impliedCount);
+        if (leafPairs == 0 || denseCost > edges.size()) {
+            for (const auto &[src, dst, weight] : edges) {
+                corrections.addAddition(first, second, src, dst, weight);
+            }
+            return;
+        }
+
+        corrections.setSuperedge(first, second, impliedWeight);
+        std::vector<EdgeObject> present;
+        present.reserve(edges.size());
+        for (const auto &[src, dst, weight] : edges) {
+            present.push_back(orderedEdge(isUndirected, src, dst));
+            if (weight != impliedWeight) {
+                corrections.addAddition(first, second, src, dst, weight);
+            }
+        }
+        std::sort(present.begin(), present.end());
+        forEachLeafPair<isUndirected>(index, first, second, [&](int src, int dst) {
+            if (!std::binary_search(present.begin(), present.end(), orderedEdge(isUndirected, src, dst))) {
+                corrections.addRemoval(first, second, src, dst);
+            }
+        });
+    }
+
+    template <bool isUndirected, typename GraphType>
+    CorrectionSet encodeSummary(const GraphType &summary) {
+        const HierarchyIndex &index = summary.getHierarchyIndex();
+        CorrectionSet corrections(!isUndirected);
+
+        // group the edges between the leaves by the pair of their roots
+        std::map<std::pair<int, int>, std::vector<WeightedEdgeObject>> groups;
+        auto addEdge = [&](int src, int dst, double weight) {
+            if (!isLeaf(index, src) || !isLeaf(index, dst)) {
+                return;
+            }
+            int first = index.getRoot(src);
+            int second = index.getRoot(dst);
+            if (src == dst) {
+                corrections.addAddition(first, second, src, dst, weight);
+                return;
+            }
+            if (isUndirected && second < first) {
+                std::swap(first, second);
+            }
+            groups[{first, second}].emplace_back(src, dst, weight);
+        };
+        if constexpr (isUndirected) {
+            for (const auto &[src, dst, weight] : summary.getEdges(true)) {
+                addEdge(src, dst, weight);
+            }
+        } else {
+            for (const auto &[src, dst, weight] : summary.getEdges()) {
+                addEdge(src, dst, weight);
+            }
+        }
+
+        for (auto &[pair, edges] : groups) {
+            encodePair<isUndirected>(index, pair.first, pair.second, edges, corrections);
+        }
+        spdlog::debug("encoded {} supernode pairs into {} superedges and {} corrections", groups.size(), corrections.getSuperedgeCount(), corrections.getCorrectionCount());
+        return corrections;
+    }
+
+    template <bool isUndirected>
+    void decompressPair(const HierarchyIndex &index, const CorrectionSet &corrections, int first, int second, const std::function<void(int, int, double)> &emit) {
+        const std::span<const WeightedEdgeObject> additions = corrections.getAdditions(first, second);
+        if (corrections.hasSuperedge(first, second)) {
+            const double weight = corrections.getSuperedgeWeight(first, second);
+            const std::span<const EdgeObject> removals = corrections.getRemovals(first, second);
+            auto isAdded = [&](const EdgeObject &edge) {
+                const auto it = std::lower_bound(additions.begin(), additions.end(), edge, [](const WeightedEdgeObject &addition, const EdgeObject &key) {
+                    return std::tie(std::get<0>(addition), std::get<1>(addition)) < key;
+                });
+                return it != additions.end() && std::get<0>(*it) == std::get<0>(edge) && std::get<1>(*it) == std::get<1>(edge);
+            };
+            forEachLeafPair<isUndirected>(index, first, second, [&](int src, int dst) {
+                const EdgeObject edge = orderedEdge(isUndirected, src, dst);
+                // a re-weighted edge is emitted with the additions
+                if (std::binary_search(removals.begin(), removals.end(), edge) || isAdded(edge)) {
+                    return;
+                }
+                emit(std::get<0>(edge), std::get<1>(edge), weight);
+            });
+        }
+        for (const auto &[src, dst, weight] : additions) {
+            emit(src, dst, weight);
+        }
+    }
+
+    template <bool isUndirected, typename GraphType>
+    void decompressSummary(const GraphType &summary, const CorrectionSet &corrections, const std::function<void(int, int, double)> &emit) {
+        if (corrections.isDirected() == isUndirected) {
+            throw std::invalid_argument("The corrections do not match the direction of the graph");
+        }
+        const HierarchyIndex &index = summary.getHierarchyIndex();
+        for (const auto &[first, second] : corrections.getSupernodePairs()) {
+            decompressPair<isUndirected>(index, corrections, first, second, emit);
+        }
+    }
+
+    template <bool isUndirected, typename GraphType>
+    void decompressSupernodes(const GraphType &summary, const CorrectionSet &corrections, int first, int second, const std::function<void(int, int, double)> &emit) {
+        if (corrections.isDirected() == isUndirected) {
+            throw std::invalid_argument("The corrections do not match the direction of the graph");
+        }
+        const HierarchyIndex &index = summary.getHierarchyIndex();
+        if (index.getRoot(first) != first || index.getRoot(second) != second) {
+            throw std::invalid_argument("Node is not a root supernode");
+        }
+        decompressPair<isUndirected>(index, corrections, first, second, emit);
+    }
+}
+
+namespace anagraph {
+namespace decompression {
+
+graph_structure::CorrectionSet encode(const graph_structure::WeightedSupergraph &summary) {
+    return encodeSummary<true>(summary);
+}
+
+graph_structure::CorrectionSet encode(const graph_structure::WeightedSuperDigraph &summary) {
+    return encodeSummary<false>(summary);
+}
+
+void decompress(const graph_structure::WeightedSupergraph &summary, const graph_structure::CorrectionSet &corrections, const std::function<void(int, int, double)> &emit) {
+    decompressSummary<true>(summary, corrections, emit);
+}
+
+void decompress(const graph_structure::WeightedSupergraph &summary, const graph_structure::CorrectionSet &corrections, int first, int second, const std::function<void(int, int, double)> &emit) {
+    decompressSupernodes<true>(summary, corrections, first, second, emit);
+}
+
+void decompress(const graph_structure::WeightedSuperDigraph &summary, const graph_structure::CorrectionSet &corrections, const std::function<void(int, int, double)> &emit) {
+    decompressSummary<false>(summary, corrections, emit);
+}
+
+void decompress(const graph_structure::WeightedSuperDigraph &summary, const graph_structure::CorrectionSet &corrections, int first, int second, const std::function<void(int, int, double)> &emit) {
+    decompressSupernodes<false>(summary, corrections, first, second, emit);
+}
+
+} // namespace decompression
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "anagraph/algorithms/local_clustering.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+    using namespace anagraph;
+
+    constexpr double DEFAULT_ALPHA = 0.15;
+    constexpr double DEFAULT_EPSILON = 1e-4;
+
+    int idOf(int id) {
+        return id;
+    }
+
+    int idOf(const std::pair<const int, double> &entry) {
+        return entry.first;
+    }
+
+    double weightOf(int) {
+        return 1.0;
+    }
+
+    double weightOf(const std::pair<const int, double> &entry) {
+        return entry.second;
+    }
+
+    template <typename GraphType>
+    double degreeOf(const GraphType &graph, int id) {
+        double degree = 0.0;
+        for (const auto &entry : graph.getAdjacents(id)) {
+            degree += weightOf(entry);
+        }
+        return degree;
+    }
+
+    double degreeOf(const graph_structure::Graph &graph, int id) {
+        return graph.getAdjacents(id).size();
+    }
+
+    template <typename GraphType>
+    double volumeOf(const GraphType &graph) {
+        double volume = 0.0;
+        for (const int id : graph.getIdRange()) {
+            volume += degreeOf(graph, id);
+        }
+        return volume;
+    }
+
+    template <typename GraphType>
+    local_clustering::LocalCluster findClusterHelper(const GraphType &graph, int seed, double alpha, double epsilon, std::optional<double> totalVolume) {
+        if (!(alpha > 0 && alpha <= 1)) {
+            throw std::invalid_argument("alpha must be in (0, 1]");
+        }
+        if (!(epsilon > 0)) {
+            throw std::invalid_argument("epsilon must be positive");
+        }
+        // the degrees are cached only for the touched nodes
+        std::unordered_map<int, double> degrees;
+        auto degree = [&](int id) {
+            const auto [it, isInserted] = degrees.try_emplace(id, 0.0);
+            if (isInserted) {
+                it->second = degreeOf(graph, id);
+            }
+            return it->second;
+        };
+        if (degree(seed) == 0) {
+            return local_clustering::LocalCluster{{seed}, 1.0, 0.0, 0.0};
+        }
+
+        // push the residue by the lazy random walk, which keeps half of the residue at the node
+        std::unordered_map<int, double> ppr;
+        std::unordered_map<int, double> residues = {{seed, 1.0}};
+        std::deque<int> queue = {seed};
+        std::unordered_set<int> isQueued = {seed};
+        size_t pushCount = 0;
+        while (!queue.empty()) {
+            const int src = queue.front();
+            queue.pop_front();
+            isQueued.erase(src);
+            const double srcDegree = degree(src);
+            const double residue = residues[src];
+            if (srcDegree == 0 || residue < epsilon * srcDegree) {
+                continue;
+            }
+            ppr[src] += alpha * residue;
+            residues[src] = (1 - alpha) * residue / 2;
+            const double pushed = (1 - alpha) * residue / (2 * srcDegree);
+            for (const auto &entry : graph.getAdjacents(src)) {
+                const int dst = idOf(entry);
+                double &dstResidue = residues[dst];
+                dstResidue += pushed * weightOf(entry);
+                if (dstResidue >= epsilon * degree(dst) && isQueued.insert(dst).second) {
+                    queue.push_back(dst);
+                }
+            }
+            if (residues[src] >= epsilon * srcDegree && isQueued.insert(src).second) {
+                queue.push_back(src);
+            }
+            pushCount++;
+        }
+
+        // sweep the nodes in the descending order of the PageRank per unit degree
+        std::vector<std::pair<double, int>> order;
+        order.reserve(ppr.size());
+        for (const auto &[id, value] : ppr) {
+            order.emplace_back(value / degree(id), id);
+        }
+        std::sort(order.begin(), order.end(), [](const auto &a, const auto &b) {
+            return a.first > b.first || (a.first == b.first && a.second < b.second);
+        });
+        // every adjacent of a pushed node is touched, so the touched nodes outside of a prefix bound its complement from below
+        double touchedVolume = 0.0;
+        for (const auto &[id, value] : degrees) {
+            touchedVolume += value;
+        }
+        std::unordered_set<int> members;
+        double volume = 0.0;
+        double cut = 0.0;
+        local_clustering::LocalCluster best{{seed}, std::numeric_limits<double>::infinity(), 0.0, 0.0};
+        size_t bestSize = 0;
+        for (size_t i = 0; i < order.size(); i++) {
+            const int id = order[i].second;
+            // the edges to the members are no longer cut, and the other edges are newly cut
+            double inside = 0.0;
+            double selfLoop = 0.0;
+            for (const auto &entry : graph.getAdjacents(id)) {
+                if (idOf(entry) == id) {
+                    selfLoop += weightOf(entry);
+                } else if (members.contains(idOf(entry))) {
+                    inside += weightOf(entry);
+                }
+            }
+            members.insert(id);
+            volume += degree(id);
+            cut = std::max(0.0, cut + degree(id) - selfLoop - 2 * inside);
+            if (!totalVolume && volume > touchedVolume - volume) {
+                totalVolume = volumeOf(graph);
+                spdlog::debug("the prefix of volume {} needs the volume of the whole graph {}", volume, *totalVolume);
+            }
+            const double denominator = totalVolume ? std::min(volume, *totalVolume - volume) : volume;
+            if (denominator <= 0) {
+                break;
+            }
+            const double conductance = cut / denominator;
+            if (conductance < best.conductance) {
+                best.conductance = conductance;
+                best.volume = volume;
+                best.cut = cut;
+                bestSize = i + 1;
+            }
+        }
+        spdlog::debug("pushed {} times from {}, swept {} nodes into a cluster of {}", pushCount, seed, order.size(), bestSize);
+
+        if (bestSize == 0) {
+            return local_clustering::LocalCluster{{seed}, 1.0, degree(seed), degree(seed)};
+        }
+        best.ids.clear();
+        for (size_t i = 0; i < bestSize; i++) {
+            best.ids.push_back(order[i].second);
+        }
+        std::sort(best.ids.begin(), best.ids.end());
+        return best;
+    }
+}
+
+namespace anagraph {
+namespace local_clustering {
+
+LocalCluster findCluster(const graph_structure::Graph &graph, int seed) {
+    return findCluster(graph, seed, DEFAULT_ALPHA, DEFAULT_EPSILON);
+}
+
+LocalCluster findCluster(const graph_structure::Graph &graph, int seed, double alpha, double epsilon) {
+    return findClusterHelper(graph, seed, alpha, epsilon, std::nullopt);
+}
+
+LocalCluster findCluster(const graph_structure::Graph &graph, int seed, double alpha, double epsilon, double totalVolume) {
+    return findClusterHelper(graph, seed, alpha, epsilon, totalVolume);
+}
+
+LocalCluster findCluster(const graph_structure::WeightedGraph &graph, int seed) {
+    return findCluster(graph, seed, DEFAULT_ALPHA, DEFAULT_EPSILON);
+}
+
+LocalCluster findCluster(const graph_structure::WeightedGraph &graph, int seed, double alpha, double epsilon) {
+    return findClusterHelper(graph, seed, alpha, epsilon, std::nullopt);
+}
+
+LocalCluster findCluster(const graph_structure::WeightedGraph &graph, int seed, double alpha, double epsilon, double totalVolume) {
+    return findClusterHelper(graph, seed, alpha, epsilon, totalVolume);
+}
+
+} // namespace local_clustering
+} // namespace anagraph
\ No newline at end of file
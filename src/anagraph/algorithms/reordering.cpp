@@ -0,0 +1,311 @@
+#include "anagraph/algorithms/reordering.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace anagraph;
+
+    /**
+     * @brief The graph indexed by the position of the node in the sorted ids.
+     *
+     * adjacents are symmetric, sorted by the index and contain no self loops,
+     * degrees are the sum of the in-degree and the out-degree in the original graph.
+     */
+    struct IndexedGraph {
+        std::vector<int> ids;
+        std::vector<std::vector<std::pair<int, double>>> adjacents;
+        std::vector<int> degrees;
+    };
+
+    template <typename Func>
+    void forEachAdjacent(const std::unordered_map<int, double> &adjacents, Func func) {
+        for (const auto &[dst, weight] : adjacents) {
+            func(dst, weight);
+        }
+    }
+
+    template <typename Func>
+    void forEachAdjacent(const std::unordered_set<int> &adjacents, Func func) {
+        for (const int dst : adjacents) {
+            func(dst, 1.0);
+        }
+    }
+
+    template <typename GraphType>
+    IndexedGraph toIndexedGraph(const GraphType &graph) {
+        IndexedGraph indexed;
+        // the ids are visited in ascending order
+        const IdRange ids = graph.getIdRange();
+        indexed.ids.assign(ids.begin(), ids.end());
+
+        const int size = indexed.ids.size();
+        std::unordered_map<int, int> indexOf;
+        indexOf.reserve(size);
+        for (int i = 0; i < size; i++) {
+            indexOf[indexed.ids[i]] = i;
+        }
+
+        indexed.adjacents.resize(size);
+        indexed.degrees.assign(size, 0);
+        for (int src = 0; src < size; src++) {
+            forEachAdjacent(graph.getAdjacents(indexed.ids[src]), [&](int dstId, double weight) {
+                auto it = indexOf.find(dstId);
+                if (it == indexOf.end()) {
+                    return;
+                }
+                const int dst = it->second;
+                indexed.degrees[src]++;
+                indexed.degrees[dst]++;
+                if (src != dst) {
+                    indexed.adjacents[src].emplace_back(dst, weight);
+                    indexed.adjacents[dst].emplace_back(src, weight);
+                }
+            });
+        }
+
+        // merge the edges in both directions
+        for (auto &adjacents : indexed.adjacents) {
+            std::sort(adjacents.begin(), adjacents.end(), [](const auto &a, const auto &b) {
+                return a.first < b.first || (a.first == b.first && a.second > b.second);
+            });
+            auto last = std::unique(adjacents.begin(), adjacents.end(), [](const auto &a, const auto &b) {
+                return a.first == b.first;
+            });
+            adjacents.erase(last, adjacents.end());
+        }
+        return indexed;
+    }
+
+    std::unordered_map<int, int> toIdMap(const IndexedGraph &indexed, const std::vector<int> &order) {
+        std::unordered_map<int, int> idMap;
+        idMap.reserve(order.size());
+        for (size_t newId = 0; newId < order.size(); newId++) {
+            idMap[indexed.ids[order[newId]]] = newId;
+        }
+        return idMap;
+    }
+
+    std::unordered_map<int, int> calcDegreeOrder(const IndexedGraph &indexed) {
+        std::vector<int> order(indexed.ids.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return indexed.degrees[a] > indexed.degrees[b];
+        });
+        return toIdMap(indexed, order);
+    }
+
+    std::unordered_map<int, int> calcReverseCuthillMcKee(const IndexedGraph &indexed) {
+        const int size = indexed.ids.size();
+        auto degreeOf = [&](int node) {
+            return indexed.adjacents[node].size();
+        };
+
+        std::vector<int> startCandidates(size);
+        std::iota(startCandidates.begin(), startCandidates.end(), 0);
+        std::stable_sort(startCandidates.begin(), startCandidates.end(), [&](int a, int b) {
+            return degreeOf(a) < degreeOf(b);
+        });
+
+        std::vector<int> order;
+        order.reserve(size);
+        std::vector<bool> visited(size, false);
+        std::vector<int> nextNodes;
+        for (int start : startCandidates) {
+            if (visited[start]) {
+                continue;
+            }
+            // BFS in the component of start
+            std::queue<int> queue;
+            queue.push(start);
+            visited[start] = true;
+            while (!queue.empty()) {
+                const int current = queue.front();
+                queue.pop();
+                order.push_back(current);
+
+                nextNodes.clear();
+                for (const auto &[adj, _] : indexed.adjacents[current]) {
+                    if (!visited[adj]) {
+                        visited[adj] = true;
+                        nextNodes.push_back(adj);
+                    }
+                }
+                std::stable_sort(nextNodes.begin(), nextNodes.end(), [&](int a, int b) {
+                    return degreeOf(a) < degreeOf(b);
+                });
+                for (int next : nextNodes) {
+                    queue.push(next);
+                }
+            }
+        }
+        std::reverse(order.begin(), order.end());
+        return toIdMap(indexed, order);
+    }
+
+    std::unordered_map<int, int> calcCommunityOrder(const IndexedGraph &indexed) {
+        const int size = indexed.ids.size();
+        std::vector<double> degrees(size, 0.0); /**< the weighted degree of each community */
+        std::vector<std::vector<std::pair<int, double>>> communityAdjacents = indexed.adjacents;
+        for (int node = 0; node < size; node++) {
+            for (const auto &[_, weight] : indexed.adjacents[node]) {
+                degrees[node] += weight;
+            }
+        }
+        const double totalDegree = std::reduce(degrees.begin(), degrees.end());
+
+        // union-find over the merged nodes, the root is the representative of the community
+        std::vector<int> parents(size);
+        std::iota(parents.begin(), parents.end(), 0);
+        auto find = [&](int node) {
+            while (parents[node] != node) {
+                parents[node] = parents[parents[node]];
+                node = parents[node];
+            }
+            return node;
+        };
+        std::vector<std::vector<int>> children(size); /**< the dendrogram of the merges */
+
+        std::vector<int> visitOrder(size);
+        std::iota(visitOrder.begin(), visitOrder.end(), 0);
+        std::stable_sort(visitOrder.begin(), visitOrder.end(), [&](int a, int b) {
+            return degrees[a] < degrees[b];
+        });
+
+        std::vector<double> aggregated(size, 0.0);
+        std::vector<bool> isTouched(size, false);
+        std::vector<int> touched;
+        for (int node : visitOrder) {
+            if (totalDegree == 0) {
+                break;
+            }
+            // aggregate the edges of the node by the adjacent communities
+            touched.clear();
+            for (const auto &[adj, weight] : communityAdjacents[node]) {
+                const int community = find(adj);
+                if (community == node) {
+                    continue;
+                }
+                if (!isTouched[community]) {
+                    isTouched[community] = true;
+                    touched.push_back(community);
+                }
+                aggregated[community] += weight;
+            }
+
+            // find the community with the largest modularity gain
+            int bestCommunity = -1;
+            double bestGain = 0.0;
+            std::vector<std::pair<int, double>> compacted;
+            compacted.reserve(touched.size());
+            for (int community : touched) {
+                const double weight = aggregated[community];
+                aggregated[community] = 0.0;
+                isTouched[community] = false;
+                compacted.emplace_back(community, weight);
+                const double gain = weight / totalDegree - degrees[node] * degrees[community] / (totalDegree * totalDegree);
+                if (gain > bestGain) {
+                    bestGain = gain;
+                    bestCommunity = community;
+                }
+            }
+
+            if (bestCommunity == -1) {
+                communityAdjacents[node] = std::move(compacted);
+                continue;
+            }
+            // merge the node into the community
+            parents[node] = bestCommunity;
+            degrees[bestCommunity] += degrees[node];
+            children[bestCommunity].push_back(node);
+            auto &bestAdjacents = communityAdjacents[bestCommunity];
+            for (const auto &edge : compacted) {
+                if (edge.first != bestCommunity) {
+                    bestAdjacents.push_back(edge);
+                }
+            }
+            communityAdjacents[node].clear();
+            communityAdjacents[node].shrink_to_fit();
+        }
+
+        // assign the ids by DFS on the dendrogram
+        std::vector<int> order;
+        order.reserve(size);
+        std::vector<int> stack;
+        for (int root = 0; root < size; root++) {
+            if (parents[root] != root) {
+                continue;
+            }
+            stack.push_back(root);
+            while (!stack.empty()) {
+                const int current = stack.back();
+                stack.pop_back();
+                order.push_back(current);
+                for (auto it = children[current].rbegin(); it != children[current].rend(); it++) {
+                    stack.push_back(*it);
+                }
+            }
+        }
+        spdlog::debug("communityOrder: {} nodes ordered", order.size());
+        return toIdMap(indexed, order);
+    }
+}
+
+namespace anagraph {
+namespace reordering {
+
+std::unordered_map<int, int> degreeOrder(const graph_structure::WeightedDigraph &graph) {
+    return calcDegreeOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> degreeOrder(const graph_structure::WeightedGraph &graph) {
+    return calcDegreeOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> degreeOrder(const graph_structure::Digraph &graph) {
+    return calcDegreeOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> degreeOrder(const graph_structure::Graph &graph) {
+    return calcDegreeOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::WeightedDigraph &graph) {
+    return calcReverseCuthillMcKee(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::WeightedGraph &graph) {
+    return calcReverseCuthillMcKee(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::Digraph &graph) {
+    return calcReverseCuthillMcKee(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> reverseCuthillMcKee(const graph_structure::Graph &graph) {
+    return calcReverseCuthillMcKee(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> communityOrder(const graph_structure::WeightedDigraph &graph) {
+    return calcCommunityOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> communityOrder(const graph_structure::WeightedGraph &graph) {
+    return calcCommunityOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> communityOrder(const graph_structure::Digraph &graph) {
+    return calcCommunityOrder(toIndexedGraph(graph));
+}
+
+std::unordered_map<int, int> communityOrder(const graph_structure::Graph &graph) {
+    return calcCommunityOrder(toIndexedGraph(graph));
+}
+
+} // namespace reordering
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,300 @@
+#include "anagraph/algorithms/shortest_path.hpp"
+
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+    constexpr double MAX_BUCKET = 0x1p62;
+
+    void validateWeights(const CompressedGraph &graph) {
+        for (const double weight : graph.getWeights()) {
+            if (weight < 0) {
+                throw std::invalid_argument("Weights must not be negative");
+            }
+        }
+    }
+
+    /**
+     * @brief Check that the bucket of any distance, at most the maximum weight times n - 1, fits in size_t.
+     */
+    void validateDelta(const CompressedGraph &graph, double delta) {
+        if (!(delta > 0)) {
+            throw std::invalid_argument("delta must be positive");
+        }
+        const auto weights = graph.getWeights();
+        const double maxWeight = weights.empty() ? 0.0 : *std::max_element(weights.begin(), weights.end());
+        if (maxWeight * (static_cast<double>(graph.size()) - 1) / delta >= MAX_BUCKET) {
+            throw std::invalid_argument("delta is too small for the weights");
+        }
+    }
+
+    double meanWeight(const CompressedGraph &graph) {
+        const auto weights = graph.getWeights();
+        double sum = 0.0;
+        for (const double weight : weights) {
+            sum += weight;
+        }
+        return sum > 0 ? sum / weights.size() : 1.0;
+    }
+
+    /**
+     * @brief Convert the parents from the indices to the ids.
+     */
+    shortest_path::ShortestPathResult toResult(const CompressedGraph &graph, std::vector<double> &&distances, const std::vector<int> &parents) {
+        shortest_path::ShortestPathResult result;
+        result.parents.resize(graph.size(), shortest_path::UNREACHED);
+        for (size_t i = 0; i < graph.size(); i++) {
+            if (parents[i] != shortest_path::UNREACHED) {
+                result.parents[i] = graph.getId(parents[i]);
+            }
+        }
+        result.distances = std::move(distances);
+        return result;
+    }
+
+    /**
+     * @class IndexedHeap
+     * @brief A d-ary min-heap of the nodes keyed by their distances, which decreases the key of a node in place.
+     */
+    template <size_t ARITY>
+    class IndexedHeap {
+    private:
+        static constexpr int ABSENT = -1;
+
+        const std::vector<double> &keys;
+        std::vector<int> heap;
+        std::vector<int> positions; /**< The position of each node in the heap, ABSENT if it is not in the heap */
+
+    public:
+        IndexedHeap(const std::vector<double> &keys) : keys(keys), positions(keys.size(), ABSENT) {}
+
+        bool empty() const {
+            return heap.empty();
+        }
+
+        /**
+         * @brief Insert a node, or move it up after its key is decreased.
+         */
+        void push(int node) {
+            if (positions[node] == ABSENT) {
+                positions[node] = heap.size();
+                heap.push_back(node);
+            }
+            siftUp(positions[node]);
+        }
+
+        int pop() {
+            const int top = heap.front();
+            positions[top] = ABSENT;
+            const int last = heap.back();
+            heap.pop_back();
+            if (!heap.empty()) {
+                heap.front() = last;
+                positions[last] = 0;
+                siftDown(0);
+            }
+            return top;
+        }
+
+    private:
+        void place(size_t position, int node) {
+            heap[position] = node;
+            positions[node] = position;
+        }
+
+        void siftUp(size_t position) {
+            const int node = heap[position];
+            while (position > 0) {
+                const size_t parent = (position - 1) / ARITY;
+                if (keys[heap[parent]] <= keys[node]) {
+                    break;
+                }
+                place(position, heap[parent]);
+                position = parent;
+            }
+            place(position, node);
+        }
+
+        void siftDown(size_t position) {
+            const int node = heap[position];
+            while (true) {
+                const size_t first = position * ARITY + 1;
+                if (first >= heap.size()) {
+                    break;
+                }
+                size_t smallest = first;
+                for (size_t child = first + 1; child < std::min(first + ARITY, heap.size()); child++) {
+                    if (keys[heap[child]] < keys[heap[smallest]]) {
+                        smallest = child;
+                    }
+                }
+                if (keys[node] <= keys[heap[smallest]]) {
+                    break;
+                }
+                place(position, heap[smallest]);
+                position = smallest;
+            }
+            place(position, node);
+        }
+    };
+
+    /**
+     * @brief Relax the out-edges of a frontier of a bucket in parallel.
+     * @return The pairs of the bucket and the node whose distance decreased
+     */
+    std::vector<std::pair<size_t, int>> relaxFrontier(const CompressedGraph &graph, const std::vector<int> &frontier, double delta, int numThreads, std::vector<double> &distances, std::vector<int> &parents, std::atomic_flag *locks) {
+        const size_t blocks = std::min(static_cast<size_t>(numThreads), frontier.size());
+        const size_t blockSize = (frontier.size() + blocks - 1) / blocks;
+        std::vector<std::vector<std::pair<size_t, int>>> updates(blocks);
+        parallel::parallelFor(0, blocks, numThreads, [&](size_t block) {
+            const size_t blockEnd = std::min(frontier.size(), (block + 1) * blockSize);
+            for (size_t i = block * blockSize; i < blockEnd; i++) {
+                const int src = frontier[i];
+                const double srcDistance = std::atomic_ref<double>(distances[src]).load(std::memory_order_relaxed);
+                const auto adjacents = graph.getAdjacents(src);
+                const auto weights = graph.getWeights(src);
+                for (size_t e = 0; e < adjacents.size(); e++) {
+                    const int dst = adjacents[e];
+                    const double candidate = srcDistance + weights[e];
+                    std::atomic_ref<double> dstDistance(distances[dst]);
+                    if (candidate >= dstDistance.load(std::memory_order_relaxed)) {
+                        continue;
+                    }
+                    // the distance and the parent are updated together under the lock of dst
+                    while (locks[dst].test_and_set(std::memory_order_acquire)) {
+                    }
+                    const bool isImproved = candidate < dstDistance.load(std::memory_order_relaxed);
+                    if (isImproved) {
+                        dstDistance.store(candidate, std::memory_order_relaxed);
+                        parents[dst] = src;
+                    }
+                    locks[dst].clear(std::memory_order_release);
+                    if (isImproved) {
+                        updates[block].emplace_back(static_cast<size_t>(candidate / delta), dst);
+                    }
+                }
+            }
+        });
+
+        std::vector<std::pair<size_t, int>> merged;
+        for (const auto &blockUpdates : updates) {
+            merged.insert(merged.end(), blockUpdates.begin(), blockUpdates.end());
+        }
+        return merged;
+    }
+}
+
+namespace anagraph {
+namespace shortest_path {
+
+ShortestPathResult dijkstra(const graph_structure::WeightedDigraph &graph, int source) {
+    return dijkstra(graph_structure::CompressedGraph(graph), source);
+}
+
+ShortestPathResult dijkstra(const graph_structure::WeightedGraph &graph, int source) {
+    return dijkstra(graph_structure::CompressedGraph(graph), source);
+}
+
+ShortestPathResult dijkstra(const graph_structure::CompressedGraph &graph, int source) {
+    validateWeights(graph);
+    const int sourceIndex = graph.getIndex(source);
+    std::vector<double> distances(graph.size(), INFINITE_DISTANCE);
+    std::vector<int> parents(graph.size(), UNREACHED);
+    distances[sourceIndex] = 0.0;
+    parents[sourceIndex] = sourceIndex;
+
+    IndexedHeap<4> heap(distances);
+    heap.push(sourceIndex);
+    while (!heap.empty()) {
+        const int src = heap.pop();
+        const auto adjacents = graph.getAdjacents(src);
+        const auto weights = graph.getWeights(src);
+        for (size_t e = 0; e < adjacents.size(); e++) {
+            const int dst = adjacents[e];
+            const double candidate = distances[src] + weights[e];
+            if (candidate < distances[dst]) {
+                distances[dst] = candidate;
+                parents[dst] = src;
+                heap.push(dst);
+            }
+        }
+    }
+    return toResult(graph, std::move(distances), parents);
+}
+
+ShortestPathResult deltaStepping(const graph_structure::WeightedDigraph &graph, int source) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return deltaStepping(compressed, source, meanWeight(compressed), 1);
+}
+
+ShortestPathResult deltaStepping(const graph_structure::WeightedDigraph &graph, int source, double delta, int numThreads) {
+    return deltaStepping(graph_structure::CompressedGraph(graph), source, delta, numThreads);
+}
+
+ShortestPathResult deltaStepping(const graph_structure::WeightedGraph &graph, int source) {
+    const graph_structure::CompressedGraph compressed(graph);
+    return deltaStepping(compressed, source, meanWeight(compressed), 1);
+}
+
+ShortestPathResult deltaStepping(const graph_structure::WeightedGraph &graph, int source, double delta, int numThreads) {
+    return deltaStepping(graph_structure::CompressedGraph(graph), source, delta, numThreads);
+}
+
+ShortestPathResult deltaStepping(const graph_structure::CompressedGraph &graph, int source, double delta, int numThreads) {
+    validateWeights(graph);
+    validateDelta(graph, delta);
+    const int sourceIndex = graph.getIndex(source);
+    const int threads = std::max(1, numThreads);
+    std::vector<double> distances(graph.size(), INFINITE_DISTANCE);
+    std::vector<int> parents(graph.size(), UNREACHED);
+    distances[sourceIndex] = 0.0;
+    parents[sourceIndex] = sourceIndex;
+    const std::unique_ptr<std::atomic_flag[]> locks(new std::atomic_flag[graph.size()]);
+
+    // only the non-empty buckets are kept, so a small delta costs no memory for the empty ones between them,
+    // and a node may be left in a bucket after its distance decreases, and such a stale entry is skipped
+    std::map<size_t, std::vector<int>> buckets = {{0, {sourceIndex}}};
+    std::vector<int> frontier;
+    size_t phases = 0;
+    size_t bucketCount = 0;
+    while (!buckets.empty()) {
+        const size_t current = buckets.begin()->first;
+        bucketCount++;
+        for (auto it = buckets.begin(); it != buckets.end() && it->first == current; it = buckets.find(current)) {
+            frontier.clear();
+            frontier.swap(it->second);
+            buckets.erase(it);
+            std::sort(frontier.begin(), frontier.end());
+            frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+            frontier.erase(std::remove_if(frontier.begin(), frontier.end(), [&](int node) {
+                return static_cast<size_t>(distances[node] / delta) != current;
+            }), frontier.end());
+            if (frontier.empty()) {
+                continue;
+            }
+
+            for (const auto &[bucket, node] : relaxFrontier(graph, frontier, delta, threads, distances, parents, locks.get())) {
+                buckets[bucket].push_back(node);
+            }
+            phases++;
+        }
+    }
+    spdlog::debug("delta-stepping from {} relaxed {} frontiers in {} buckets", source, phases, bucketCount);
+    return toResult(graph, std::move(distances), parents);
+}
+
+} // namespace shortest_path
+} // namespace anagraph
\ No newline at end of file
@@ -1,72 +1,392 @@
 #include "anagraph/algorithms/similarity.hpp"
 
+#include "anagraph/algorithms/vector_kernels.hpp"
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
 #include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace {
     using namespace anagraph;
-    std::tuple<int, int, int, int> calcConfusionMatrix(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer) {
-        int tp = 0;
-        int fp = 0;
-        int fn = 0;
-        int tn = 0;
-        std::unordered_set<int> nodes = expected.getIds();
-
-        for (int node : nodes) {
-            const std::unordered_set<int> expectedAdjacents = expected.getAdjacents(node);
-            const std::unordered_set<int> answerAdjacents = answer.getAdjacents(node);
-            for (int adj : nodes) {
-                if (node == adj) {
-                    continue; // exclude self loop
+
+    void checkTopK(const std::vector<double>& expected, const std::vector<double>& answer, int k) {
+        if (expected.size() != answer.size()) {
+            throw std::invalid_argument("Vectors must have the same size");
+        }
+        if (static_cast<size_t>(k) > expected.size()) {
+            throw std::invalid_argument("k must be less than or equal to the size of the vectors");
+        }
+        if (k <= 0) {
+            throw std::invalid_argument("k must be greater than 0");
+        }
+    }
+
+    /**
+     * @brief Get the indices of the k largest values in descending order.
+     *
+     * @note Ties are broken by the smaller index. The cost is O(n + k log k).
+     */
+    std::vector<int> topK(const std::vector<double>& values, int k) {
+        std::vector<int> indices(values.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        auto isHigher = [&](int a, int b) {
+            return values[a] > values[b] || (values[a] == values[b] && a < b);
+        };
+        if (static_cast<size_t>(k) < indices.size()) {
+            std::nth_element(indices.begin(), indices.begin() + k, indices.end(), isHigher);
+            indices.resize(k);
+        }
+        std::sort(indices.begin(), indices.end(), isHigher);
+        return indices;
+    }
+
+    /**
+     * @brief Mark the top-k elements of expected as relevant.
+     */
+    std::vector<bool> topKRelevance(const std::vector<double>& expected, int k) {
+        std::vector<bool> relevant(expected.size(), false);
+        for (int index : topK(expected, k)) {
+            relevant[index] = true;
+        }
+        return relevant;
+    }
+
+    /**
+     * @brief Mark the elements of expected above a threshold as relevant.
+     */
+    std::vector<bool> thresholdRelevance(const std::vector<double>& expected, double threshold) {
+        std::vector<bool> relevant(expected.size(), false);
+        for (size_t i = 0; i < expected.size(); i++) {
+            relevant[i] = expected[i] > threshold;
+        }
+        return relevant;
+    }
+
+    /**
+     * @brief Count the relevant elements in the top-k elements of answer.
+     */
+    size_t countRelevantInTopK(const std::vector<bool>& relevant, const std::vector<double>& answer, int k) {
+        size_t found = 0;
+        for (int index : topK(answer, k)) {
+            found += relevant[index] ? 1 : 0;
+        }
+        return found;
+    }
+
+    /**
+     * @brief Get the indices in the top-k of either expected or answer.
+     */
+    std::vector<int> topKUnion(const std::vector<double>& expected, const std::vector<double>& answer, int k) {
+        std::vector<int> indices = topK(expected, k);
+        const std::vector<int> answerTop = topK(answer, k);
+        indices.insert(indices.end(), answerTop.begin(), answerTop.end());
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+        return indices;
+    }
+
+    /**
+     * @brief Rank the values of the indices in descending order, tied values get the average of their ranks.
+     */
+    std::vector<double> averageRanks(const std::vector<double>& values, const std::vector<int>& indices) {
+        const size_t size = indices.size();
+        std::vector<size_t> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return values[indices[a]] > values[indices[b]];
+        });
+        std::vector<double> ranks(size);
+        for (size_t begin = 0; begin < size;) {
+            size_t end = begin + 1;
+            while (end < size && values[indices[order[end]]] == values[indices[order[begin]]]) {
+                end++;
+            }
+            const double rank = (begin + end - 1) / 2.0;
+            for (size_t i = begin; i < end; i++) {
+                ranks[order[i]] = rank;
+            }
+            begin = end;
+        }
+        return ranks;
+    }
+
+    /**
+     * @brief The vectors packed into a contiguous row-major matrix.
+     */
+    struct PackedVectors {
+        std::vector<double> values;
+        size_t count;
+        size_t dimension;
+
+        const double *row(size_t i) const {
+            return values.data() + i * dimension;
+        }
+    };
+
+    PackedVectors pack(const std::vector<std::vector<double>>& vectors) {
+        PackedVectors packed{{}, vectors.size(), vectors.empty() ? 0 : vectors.front().size()};
+        packed.values.reserve(packed.count * packed.dimension);
+        for (const auto &vector : vectors) {
+            if (vector.size() != packed.dimension) {
+                throw std::invalid_argument("Vectors must have the same size");
+            }
+            packed.values.insert(packed.values.end(), vector.begin(), vector.end());
+        }
+        return packed;
+    }
+
+    /**
+     * @brief Get the number of vectors in a tile, so that the tiles of a pair fit in the L2 cache together.
+     */
+    size_t tileSize(size_t dimension) {
+        constexpr size_t cacheSize = 256 * 1024 / sizeof(double);
+        return std::clamp<size_t>(cacheSize / 2 / std::max<size_t>(dimension, 1), 1, 64);
+    }
+
+    /**
+     * @brief Compute the symmetric matrix of a pairwise value.
+     *
+     * @note Each pair of tiles is computed by a single thread, and only the upper triangle is computed.
+     */
+    template <typename PairFunc>
+    std::vector<std::vector<double>> pairwiseMatrix(const PackedVectors &packed, int numThreads, PairFunc pairValue) {
+        const size_t count = packed.count;
+        std::vector<std::vector<double>> matrix(count, std::vector<double>(count, 0.0));
+        const size_t tile = tileSize(packed.dimension);
+        const size_t tiles = (count + tile - 1) / tile;
+        std::vector<std::pair<size_t, size_t>> tilePairs;
+        tilePairs.reserve(tiles * (tiles + 1) / 2);
+        for (size_t rowTile = 0; rowTile < tiles; rowTile++) {
+            for (size_t columnTile = rowTile; columnTile < tiles; columnTile++) {
+                tilePairs.emplace_back(rowTile, columnTile);
+            }
+        }
+
+        parallel::parallelFor(0, tilePairs.size(), numThreads, [&](size_t t) {
+            const auto [rowTile, columnTile] = tilePairs[t];
+            const size_t rowEnd = std::min(count, (rowTile + 1) * tile);
+            const size_t columnEnd = std::min(count, (columnTile + 1) * tile);
+            for (size_t i = rowTile * tile; i < rowEnd; i++) {
+                for (size_t j = std::max(i, columnTile * tile); j < columnEnd; j++) {
+                    const double value = pairValue(i, j);
+                    matrix[i][j] = value;
+                    matrix[j][i] = value;
                 }
-                const bool isPositive = expectedAdjacents.contains(adj);
-                const bool isTrue = answerAdjacents.contains(adj);
-                if (isPositive && isTrue) {
-                    tp++;
-                } else if (isPositive && !isTrue) {
-                    fp++;
-                } else if (!isPositive && isTrue) {
-                    fn++;
-                } else { // !isPositive && !isTrue
-                    tn++;
+            }
+        });
+        return matrix;
+    }
+
+    /**
+     * @brief Find the k best other vectors of every vector by a pairwise value.
+     * @param isDescending If true, larger values are better
+     *
+     * @note Each tile of rows is computed by a single thread against every tile of columns,
+     * keeping the k best candidates of each row in a heap.
+     */
+    template <typename PairFunc>
+    std::vector<std::vector<std::pair<int, double>>> pairwiseTopK(const PackedVectors &packed, int k, bool isDescending, int numThreads, PairFunc pairValue) {
+        const size_t count = packed.count;
+        if (k <= 0) {
+            throw std::invalid_argument("k must be greater than 0");
+        }
+        if (static_cast<size_t>(k) >= count) {
+            throw std::invalid_argument("k must be less than the number of vectors");
+        }
+        // a candidate is better if its value is better, or if the values are equal and its index is smaller
+        auto isBetter = [isDescending](const std::pair<int, double> &a, const std::pair<int, double> &b) {
+            if (a.second != b.second) {
+                return isDescending ? a.second > b.second : a.second < b.second;
+            }
+            return a.first < b.first;
+        };
+
+        std::vector<std::vector<std::pair<int, double>>> result(count);
+        const size_t tile = tileSize(packed.dimension);
+        const size_t tiles = (count + tile - 1) / tile;
+        parallel::parallelFor(0, tiles, numThreads, [&](size_t rowTile) {
+            const size_t rowBegin = rowTile * tile;
+            const size_t rowEnd = std::min(count, rowBegin + tile);
+            for (size_t i = rowBegin; i < rowEnd; i++) {
+                result[i].reserve(k);
+            }
+            for (size_t columnBegin = 0; columnBegin < count; columnBegin += tile) {
+                const size_t columnEnd = std::min(count, columnBegin + tile);
+                for (size_t i = rowBegin; i < rowEnd; i++) {
+                    // the heap keeps the worst candidate at the front
+                    auto &heap = result[i];
+                    for (size_t j = columnBegin; j < columnEnd; j++) {
+                        if (i == j) {
+                            continue;
+                        }
+                        const std::pair<int, double> candidate(j, pairValue(i, j));
+                        if (heap.size() < static_cast<size_t>(k)) {
+                            heap.push_back(candidate);
+                            std::push_heap(heap.begin(), heap.end(), isBetter);
+                        } else if (isBetter(candidate, heap.front())) {
+                            std::pop_heap(heap.begin(), heap.end(), isBetter);
+                            heap.back() = candidate;
+                            std::push_heap(heap.begin(), heap.end(), isBetter);
+                        }
+                    }
                 }
             }
+            for (size_t i = rowBegin; i < rowEnd; i++) {
+                std::sort_heap(result[i].begin(), result[i].end(), isBetter);
+            }
+        });
+        return result;
+    }
+
+    /**
+     * @brief Get the norm of every vector.
+     */
+    std::vector<double> norms(const PackedVectors &packed) {
+        std::vector<double> result(packed.count);
+        for (size_t i = 0; i < packed.count; i++) {
+            result[i] = std::sqrt(kernels::dot(packed.row(i), packed.row(i), packed.dimension));
         }
-        return std::make_tuple(tp, fp, fn, tn);
+        return result;
     }
 
-    std::tuple<int, int, int, int> calcConfusionMatrix(const graph_structure::Graph &expected, const graph_structure::Graph &answer) {
-        int tp = 0;
-        int fp = 0;
-        int fn = 0;
-        int tn = 0;
-        std::unordered_set<int> nodes = expected.getIds();
+    /**
+     * @brief The partial counts of a block of source nodes.
+     */
+    struct ComparisonCounts {
+        int64_t tp = 0;
+        int64_t fp = 0;
+        int64_t fn = 0;
+        double absoluteError = 0.0;
+        double squaredError = 0.0;
+    };
 
-        for (int node : nodes) {
-            const std::unordered_set<int> expectedAdjacents = expected.getAdjacents(node);
-            const std::unordered_set<int> answerAdjacents = answer.getAdjacents(node);
-            for (int adj : nodes) {
-                if (node >= adj) {
-                    continue; // exclude self loop
-                }
-                const bool isPositive = expectedAdjacents.contains(adj);
-                const bool isTrue = answerAdjacents.contains(adj);
-                if (isPositive && isTrue) {
-                    tp++;
-                } else if (isPositive && !isTrue) {
-                    fp++;
-                } else if (!isPositive && isTrue) {
-                    fn++;
-                } else { // !isPositive && !isTrue
-                    tn++;
+    /**
+     * @brief Compare the graphs by merging the sorted adjacency lists of both graphs.
+     * @param expected The expected graph
+     * @param answer The answer graph
+     * @param isUndirected If true, each pair of nodes is counted once as src < dst
+     * @param numThreads The number of threads to count the nodes
+     * @return The comparison over the pairs of distinct nodes of expected
+     *
+     * @note isPositive means expected has the edge, and isTrue means answer has the edge.
+     * fp is counted when only expected has the edge, and fn when only answer has the edge.
+     * Nodes and edges of answer which are not in expected are ignored.
+     * tn is derived from the number of pairs, so the cost is O(n + m).
+     */
+    similarity::GraphComparison compare(const graph_structure::CompressedGraph &expected, const graph_structure::CompressedGraph &answer, bool isUndirected, int numThreads) {
+        const size_t size = expected.size();
+
+        // map the indices between the graphs, the ids of both graphs are sorted in ascending order
+        const auto expectedIds = expected.getIds();
+        const auto answerIds = answer.getIds();
+        std::vector<int> expectedToAnswer(size, -1);
+        std::vector<int> answerToExpected(answerIds.size(), -1);
+        for (size_t i = 0, j = 0; i < size && j < answerIds.size();) {
+            if (expectedIds[i] == answerIds[j]) {
+                expectedToAnswer[i] = j;
+                answerToExpected[j] = i;
+                i++;
+                j++;
+            } else if (expectedIds[i] < answerIds[j]) {
+                i++;
+            } else {
+                j++;
+            }
+        }
+        for (size_t i = 0; i < size; i++) {
+            if (expectedToAnswer[i] == -1) {
+                throw std::out_of_range("Node does not exist");
+            }
+        }
+
+        // each thread counts a contiguous block of the source nodes
+        const size_t threads = std::max(1, numThreads);
+        const size_t blockSize = (size + threads - 1) / threads;
+        std::vector<ComparisonCounts> counts(threads);
+        parallel::parallelFor(0, threads, static_cast<int>(threads), [&](size_t block) {
+            ComparisonCounts &count = counts[block];
+            auto addError = [&](double error) {
+                count.absoluteError += std::abs(error);
+                count.squaredError += error * error;
+            };
+            const size_t blockEnd = std::min(size, (block + 1) * blockSize);
+            for (size_t src = block * blockSize; src < blockEnd; src++) {
+                const auto expectedAdjacents = expected.getAdjacents(src);
+                const auto expectedWeights = expected.getWeights(src);
+                const auto answerAdjacents = answer.getAdjacents(expectedToAnswer[src]);
+                const auto answerWeights = answer.getWeights(expectedToAnswer[src]);
+                auto isCounted = [&](size_t dst) {
+                    return isUndirected ? dst > src : dst != src; // exclude self loop
+                };
+
+                // the mapped indices of answer are also sorted, since the mapping is monotone
+                size_t e = 0;
+                size_t a = 0;
+                while (e < expectedAdjacents.size() || a < answerAdjacents.size()) {
+                    if (a < answerAdjacents.size() && answerToExpected[answerAdjacents[a]] == -1) {
+                        a++;
+                        continue;
+                    }
+                    const size_t expectedDst = e < expectedAdjacents.size() ? expectedAdjacents[e] : size;
+                    const size_t answerDst = a < answerAdjacents.size() ? answerToExpected[answerAdjacents[a]] : size;
+                    if (expectedDst == answerDst) {
+                        if (isCounted(expectedDst)) {
+                            count.tp++;
+                            addError(expectedWeights[e] - answerWeights[a]);
+                        }
+                        e++;
+                        a++;
+                    } else if (expectedDst < answerDst) {
+                        if (isCounted(expectedDst)) {
+                            count.fp++;
+                            addError(expectedWeights[e]);
+                        }
+                        e++;
+                    } else {
+                        if (isCounted(answerDst)) {
+                            count.fn++;
+                            addError(answerWeights[a]);
+                        }
+                        a++;
+                    }
                 }
             }
+        });
+
+        ComparisonCounts total;
+        for (const auto &count : counts) {
+            total.tp += count.tp;
+            total.fp += count.fp;
+            total.fn += count.fn;
+            total.absoluteError += count.absoluteError;
+            total.squaredError += count.squaredError;
         }
-        return std::make_tuple(tp, fp, fn, tn);
+        const int64_t n = size;
+        const int64_t pairs = isUndirected ? n * (n - 1) / 2 : n * (n - 1);
+
+        similarity::GraphComparison result;
+        result.truePositive = total.tp;
+        result.falsePositive = total.fp;
+        result.falseNegative = total.fn;
+        result.trueNegative = pairs - total.tp - total.fp - total.fn;
+        spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", result.truePositive, result.falsePositive, result.falseNegative, result.trueNegative);
+
+        result.accuracy = pairs != 0 ? static_cast<double>(result.truePositive + result.trueNegative) / pairs : 0.0;
+        result.precision = (total.tp + total.fp) != 0 ? static_cast<double>(total.tp) / (total.tp + total.fp) : 0.0;
+        result.recall = (total.tp + total.fn) != 0 ? static_cast<double>(total.tp) / (total.tp + total.fn) : 0.0;
+        result.fMeasure = (result.precision + result.recall) != 0.0 ? 2 * (result.precision * result.recall) / (result.precision + result.recall) : 0.0;
+        result.l1Error = total.absoluteError;
+        result.l2Error = std::sqrt(total.squaredError);
+        return result;
     }
 }
 
@@ -79,50 +399,19 @@ double cosineSimilarity(const std::vector<double>& v1, const std::vector<double>
     if (v1Size != v2Size) {
         throw std::invalid_argument("Vectors must have the same size");
     }
-    double dotProduct = 0.0;
-    double normA = 0.0;
-    double normB = 0.0;
-    for (size_t i = 0; i < v1Size; i++) {
-        dotProduct += v1[i] * v2[i];
-        normA += v1[i] * v1[i];
-        normB += v2[i] * v2[i];
-    }
-    return dotProduct / (std::sqrt(normA) * std::sqrt(normB));
+    const kernels::DotProducts products = kernels::dotAndNorms(v1.data(), v2.data(), v1Size);
+    return products.dot / (std::sqrt(products.squaredNorm1) * std::sqrt(products.squaredNorm2));
 }
 
 double nDCG(const std::vector<double>& expected, const std::vector<double>& answer, int k) {
-    const size_t v1Size = expected.size();
-    const size_t v2Size = answer.size();
-    if (v1Size != v2Size) {
-        throw std::invalid_argument("Vectors must have the same size");
-    }
-    if (static_cast<size_t>(k) > v1Size) {
-        throw std::invalid_argument("k must be less than or equal to the size of the vectors");
-    }
-    if (k <= 0) {
-        throw std::invalid_argument("k must be greater than 0");
-    }
+    checkTopK(expected, answer, k);
+    const std::vector<int> expectedTop = topK(expected, k);
+    const std::vector<int> answerTop = topK(answer, k);
 
-    std::vector<std::pair<double, int>> expectedMap;
-    std::vector<std::pair<double, int>> answerMap;
-    for (size_t i = 0; i < expected.size(); i++) {
-        expectedMap.emplace_back(std::make_pair(expected[i], i));
-        answerMap.emplace_back(std::make_pair(answer[i], i));
-    }
-    std::sort(expectedMap.begin(), expectedMap.end(), [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
-        return a.first > b.first;
-    });
-    std::sort(answerMap.begin(), answerMap.end(), [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
-        return a.first > b.first;
-    });
-    
     double dcg = 0.0;
     double idcg = 0.0;
     for (int i = 0; i < k; i++) {
-        int expectedIdx = expectedMap[i].second;
-        int answerIdx = answerMap[i].second;
-
-        if (expectedIdx == answerIdx) {
+        if (expectedTop[i] == answerTop[i]) {
             dcg += (1 / std::log2(i + 2));
         }
         idcg += (1 / std::log2(i + 2));
@@ -134,6 +423,84 @@ double nDCG(const std::vector<double>& expected, const std::vector<double>& answ
     return nDCG(expected, answer, expected.size());
 }
 
+double precisionAtK(const std::vector<double>& expected, const std::vector<double>& answer, int k) {
+    checkTopK(expected, answer, k);
+    return static_cast<double>(countRelevantInTopK(topKRelevance(expected, k), answer, k)) / k;
+}
+
+double precisionAtK(const std::vector<double>& expected, const std::vector<double>& answer, int k, double threshold) {
+    checkTopK(expected, answer, k);
+    return static_cast<double>(countRelevantInTopK(thresholdRelevance(expected, threshold), answer, k)) / k;
+}
+
+double recallAtK(const std::vector<double>& expected, const std::vector<double>& answer, int k, double threshold) {
+    checkTopK(expected, answer, k);
+    const std::vector<bool> relevant = thresholdRelevance(expected, threshold);
+    const size_t relevantSize = std::count(relevant.begin(), relevant.end(), true);
+    if (relevantSize == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(countRelevantInTopK(relevant, answer, k)) / relevantSize;
+}
+
+double kendallTau(const std::vector<double>& expected, const std::vector<double>& answer, int k) {
+    checkTopK(expected, answer, k);
+    const std::vector<int> indices = topKUnion(expected, answer, k);
+    const size_t size = indices.size();
+
+    int64_t concordant = 0;
+    int64_t discordant = 0;
+    int64_t expectedTies = 0;
+    int64_t answerTies = 0;
+    for (size_t i = 0; i < size; i++) {
+        for (size_t j = i + 1; j < size; j++) {
+            const double expectedDiff = expected[indices[i]] - expected[indices[j]];
+            const double answerDiff = answer[indices[i]] - answer[indices[j]];
+            if (expectedDiff == 0.0) {
+                expectedTies++;
+            }
+            if (answerDiff == 0.0) {
+                answerTies++;
+            }
+            if (expectedDiff * answerDiff > 0.0) {
+                concordant++;
+            } else if (expectedDiff * answerDiff < 0.0) {
+                discordant++;
+            }
+        }
+    }
+
+    const int64_t pairs = size * (size - 1) / 2;
+    const double denominator = std::sqrt(static_cast<double>(pairs - expectedTies) * (pairs - answerTies));
+    if (denominator == 0.0) {
+        return 0.0;
+    }
+    return (concordant - discordant) / denominator;
+}
+
+double spearman(const std::vector<double>& expected, const std::vector<double>& answer, int k) {
+    checkTopK(expected, answer, k);
+    const std::vector<int> indices = topKUnion(expected, answer, k);
+    const std::vector<double> expectedRanks = averageRanks(expected, indices);
+    const std::vector<double> answerRanks = averageRanks(answer, indices);
+
+    // the Pearson correlation of the ranks, both ranks have the same mean
+    const size_t size = indices.size();
+    const double mean = (size - 1) / 2.0;
+    double covariance = 0.0;
+    double expectedVariance = 0.0;
+    double answerVariance = 0.0;
+    for (size_t i = 0; i < size; i++) {
+        covariance += (expectedRanks[i] - mean) * (answerRanks[i] - mean);
+        expectedVariance += (expectedRanks[i] - mean) * (expectedRanks[i] - mean);
+        answerVariance += (answerRanks[i] - mean) * (answerRanks[i] - mean);
+    }
+    if (expectedVariance == 0.0 || answerVariance == 0.0) {
+        return 0.0;
+    }
+    return covariance / std::sqrt(expectedVariance * answerVariance);
+}
+
 double KLdivergence(const std::vector<double>& p, const std::vector<double>& q) {
     const size_t pSize = p.size();
     const size_t qSize = q.size();
@@ -141,17 +508,7 @@ double KLdivergence(const std::vector<double>& p, const std::vector<double>& q)
         throw std::invalid_argument("Vectors must have the same size");
     }
 
-    double kl = 0.0;
-    for (size_t i = 0; i < pSize; i++) {
-        if (p[i] == 0.0) {
-            continue;
-        }
-        if (q[i] == 0.0) {
-            throw std::invalid_argument("q must not contain 0.0 when p contains non-zero value");
-        }
-        kl += p[i] * std::log2(p[i] / q[i]);
-    }
-    return kl;
+    return kernels::klDivergence(p.data(), q.data(), pSize);
 }
 
 double JSdivergence(const std::vector<double>& p, const std::vector<double>& q) {
@@ -161,87 +518,118 @@ double JSdivergence(const std::vector<double>& p, const std::vector<double>& q)
         throw std::invalid_argument("Vectors must have the same size");
     }
 
-    std::vector<double> m(pSize);
-    for (size_t i = 0; i < pSize; i++) {
-        m[i] = (p[i] + q[i]) / 2;
-    }
-    return (KLdivergence(p, m) + KLdivergence(q, m)) / 2;
+    // the midpoint distribution is computed on the fly instead of being stored
+    return kernels::jsDivergence(p.data(), q.data(), pSize);
+}
+
+std::vector<std::vector<double>> cosineSimilarityMatrix(const std::vector<std::vector<double>>& vectors) {
+    return cosineSimilarityMatrix(vectors, 1);
+}
+
+std::vector<std::vector<double>> cosineSimilarityMatrix(const std::vector<std::vector<double>>& vectors, int numThreads) {
+    const PackedVectors packed = pack(vectors);
+    const std::vector<double> norm = norms(packed);
+    return pairwiseMatrix(packed, numThreads, [&](size_t i, size_t j) {
+        return kernels::dot(packed.row(i), packed.row(j), packed.dimension) / (norm[i] * norm[j]);
+    });
+}
+
+std::vector<std::vector<double>> JSdivergenceMatrix(const std::vector<std::vector<double>>& vectors) {
+    return JSdivergenceMatrix(vectors, 1);
+}
+
+std::vector<std::vector<double>> JSdivergenceMatrix(const std::vector<std::vector<double>>& vectors, int numThreads) {
+    const PackedVectors packed = pack(vectors);
+    return pairwiseMatrix(packed, numThreads, [&](size_t i, size_t j) {
+        return kernels::jsDivergence(packed.row(i), packed.row(j), packed.dimension);
+    });
+}
+
+std::vector<std::vector<std::pair<int, double>>> topKCosineSimilarity(const std::vector<std::vector<double>>& vectors, int k) {
+    return topKCosineSimilarity(vectors, k, 1);
+}
+
+std::vector<std::vector<std::pair<int, double>>> topKCosineSimilarity(const std::vector<std::vector<double>>& vectors, int k, int numThreads) {
+    const PackedVectors packed = pack(vectors);
+    const std::vector<double> norm = norms(packed);
+    return pairwiseTopK(packed, k, true, numThreads, [&](size_t i, size_t j) {
+        return kernels::dot(packed.row(i), packed.row(j), packed.dimension) / (norm[i] * norm[j]);
+    });
+}
+
+std::vector<std::vector<std::pair<int, double>>> topKJSdivergence(const std::vector<std::vector<double>>& vectors, int k) {
+    return topKJSdivergence(vectors, k, 1);
+}
+
+std::vector<std::vector<std::pair<int, double>>> topKJSdivergence(const std::vector<std::vector<double>>& vectors, int k, int numThreads) {
+    const PackedVectors packed = pack(vectors);
+    return pairwiseTopK(packed, k, false, numThreads, [&](size_t i, size_t j) {
+        return kernels::jsDivergence(packed.row(i), packed.row(j), packed.dimension);
+    });
+}
+
+GraphComparison compareGraphs(const graph_structure::WeightedDigraph &expected, const graph_structure::WeightedDigraph &answer) {
+    return compareGraphs(expected, answer, 1);
+}
+
+GraphComparison compareGraphs(const graph_structure::WeightedDigraph &expected, const graph_structure::WeightedDigraph &answer, int numThreads) {
+    return compare(graph_structure::CompressedGraph(expected), graph_structure::CompressedGraph(answer), false, numThreads);
+}
+
+GraphComparison compareGraphs(const graph_structure::WeightedGraph &expected, const graph_structure::WeightedGraph &answer) {
+    return compareGraphs(expected, answer, 1);
+}
+
+GraphComparison compareGraphs(const graph_structure::WeightedGraph &expected, const graph_structure::WeightedGraph &answer, int numThreads) {
+    return compare(graph_structure::CompressedGraph(expected), graph_structure::CompressedGraph(answer), true, numThreads);
+}
+
+GraphComparison compareGraphs(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer) {
+    return compareGraphs(expected, answer, 1);
+}
+
+GraphComparison compareGraphs(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer, int numThreads) {
+    return compare(graph_structure::CompressedGraph(expected), graph_structure::CompressedGraph(answer), false, numThreads);
+}
+
+GraphComparison compareGraphs(const graph_structure::Graph &expected, const graph_structure::Graph &answer) {
+    return compareGraphs(expected, answer, 1);
+}
+
+GraphComparison compareGraphs(const graph_structure::Graph &expected, const graph_structure::Graph &answer, int numThreads) {
+    return compare(graph_structure::CompressedGraph(expected), graph_structure::CompressedGraph(answer), true, numThreads);
 }
 
 double accuracy(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    if (tp + fp + fn + tn == 0) {
-        return 0.0;
-    } else {
-        return static_cast<double>(tp + tn) / (tp + fp + fn + tn);
-    }
+    return compareGraphs(expected, answer).accuracy;
 }
 
 double accuracy(const graph_structure::Graph &expected, const graph_structure::Graph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    if (tp + fp + fn + tn == 0) {
-        return 0.0;
-    } else {
-        return static_cast<double>(tp + tn) / (tp + fp + fn + tn);
-    }
+    return compareGraphs(expected, answer).accuracy;
 }
 
 double precision(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    if (tp + fp == 0) {
-        return 0.0;
-    } else {
-        return static_cast<double>(tp) / (tp + fp);
-    }
+    return compareGraphs(expected, answer).precision;
 }
 
 double precision(const graph_structure::Graph &expected, const graph_structure::Graph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    if (tp + fp == 0) {
-        return 0.0;
-    } else {
-        return static_cast<double>(tp) / (tp + fp);
-    }
+    return compareGraphs(expected, answer).precision;
 }
 
 double recall(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    if (tp + fn == 0) {
-        return 0.0;
-    } else {
-        return static_cast<double>(tp) / (tp + fn);
-    }
+    return compareGraphs(expected, answer).recall;
 }
 
 double recall(const graph_structure::Graph &expected, const graph_structure::Graph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    if (tp + fn == 0) {
-        return 0.0;
-    } else {
-        return static_cast<double>(tp) / (tp + fn);
-    }
+    return compareGraphs(expected, answer).recall;
 }
 
 double fMeasure(const graph_structure::Digraph &expected, const graph_structure::Digraph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    const double precisionValue = ((tp + fp)) != 0 ? static_cast<double>(tp) / (tp + fp) : 0.0;
-    const double recallValue = ((tp + fn) != 0) ? static_cast<double>(tp) / (tp + fn) : 0.0;
-    return 2 * (precisionValue * recallValue) / (precisionValue + recallValue);
+    return compareGraphs(expected, answer).fMeasure;
 }
 
 double fMeasure(const graph_structure::Graph &expected, const graph_structure::Graph &answer) {
-    auto [tp, fp, fn, tn] = calcConfusionMatrix(expected, answer);
-    spdlog::debug("tp/fp/fn/tn = {}/{}/{}/{}", tp, fp, fn, tn);
-    const double precisionValue = ((tp + fp)) != 0 ? static_cast<double>(tp) / (tp + fp) : 0.0;
-    const double recallValue = ((tp + fn) != 0) ? static_cast<double>(tp) / (tp + fn) : 0.0;
-    return 2 * (precisionValue * recallValue) / (precisionValue + recallValue);
+    return compareGraphs(expected, answer).fMeasure;
 }
 
 } // namespace similarity
@@ -0,0 +1,329 @@
+#include "anagraph/algorithms/summarization.hpp"
+
+#include "anagraph/components/compressed_graph.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    constexpr int defaultIterations = 20;
+    constexpr size_t maxGroupSize = 500; /**< larger groups are split, since merging a group is quadratic in its size */
+    constexpr uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+    uint64_t mix(uint64_t x) {
+        // splitmix64
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief The partition of the nodes into the root supernodes.
+     */
+    struct Supernodes {
+        std::vector<int> supernodeOf; /**< The root supernode of each node index */
+        std::unordered_map<int, std::vector<int>> members; /**< The node indices of each root supernode */
+    };
+
+    using EdgeCounts = std::unordered_map<int, int64_t>;
+
+    /**
+     * @brief Merges the supernodes of a group, reading the partition at the start of the iteration.
+     *
+     * @note Only the supernodes of the group are modified, so that groups can be merged concurrently.
+     */
+    class GroupMerger {
+    private:
+        const Supernodes &snapshot;
+        std::unordered_map<int, int> representatives; /**< The supernode each supernode of the group was merged into */
+        std::unordered_map<int, int64_t> sizes; /**< The number of nodes of each representative */
+        std::unordered_map<int, EdgeCounts> counts; /**< The edge endpoints from each representative to each snapshot supernode */
+
+        int find(int id) {
+            while (representatives[id] != id) {
+                id = representatives[id];
+            }
+            return id;
+        }
+
+        int resolve(int id) {
+            return representatives.contains(id) ? find(id) : id;
+        }
+
+        int64_t sizeOf(int id) const {
+            const auto it = sizes.find(id);
+            return it == sizes.end() ? snapshot.members.at(id).size() : it->second;
+        }
+
+        /**
+         * @brief Calculate the cost to encode the edges of a supernode.
+         * @param id The representative of the supernode
+         * @param alias The representative regarded as the same supernode as id, for a tentative merge
+         * @param size The number of nodes of the supernode
+         * @param edges The edge endpoints from the supernode, inner edges counted from both ends
+         */
+        int64_t cost(int id, int alias, int64_t size, const std::vector<const EdgeCounts*> &edges) {
+            EdgeCounts resolved;
+            for (const EdgeCounts *edgeCounts : edges) {
+                for (const auto &[adjacent, count] : *edgeCounts) {
+                    const int key = resolve(adjacent);
+                    resolved[key == alias ? id : key] += count;
+                }
+            }
+            int64_t total = 0;
+            for (const auto &[adjacent, count] : resolved) {
+                int64_t pairs;
+                int64_t edgeCount = count;
+                if (adjacent == id) {
+                    pairs = size * (size - 1) / 2;
+                    edgeCount /= 2;
+                } else {
+                    pairs = size * sizeOf(adjacent);
+                }
+                // a superedge with the missing edges as corrections, or the edges themselves
+                total += std::min(pairs - edgeCount + 1, edgeCount);
+            }
+            return total;
+        }
+
+        /**
+         * @brief Calculate the weighted Jaccard similarity of the adjacent supernodes.
+         */
+        static double similarity(const EdgeCounts &first, const EdgeCounts &second) {
+            int64_t intersection = 0;
+            int64_t total = 0;
+            for (const auto &[adjacent, count] : first) {
+                const auto it = second.find(adjacent);
+                const int64_t other = it == second.end() ? 0 : it->second;
+                intersection += std::min(count, other);
+                total += std::max(count, other);
+            }
+            for (const auto &[adjacent, count] : second) {
+                if (!first.contains(adjacent)) {
+                    total += count;
+                }
+            }
+            return total == 0 ? 0.0 : static_cast<double>(intersection) / total;
+        }
+
+    public:
+        GroupMerger(const CompressedGraph &graph, const Supernodes &snapshot, const std::vector<int> &group) : snapshot(snapshot) {
+            for (const int id : group) {
+                representatives[id] = id;
+                sizes[id] = snapshot.members.at(id).size();
+                EdgeCounts &edgeCounts = counts[id];
+                for (const int node : snapshot.members.at(id)) {
+                    for (const int adjacent : graph.getAdjacents(node)) {
+                        if (adjacent != node) {
+                            edgeCounts[snapshot.supernodeOf[adjacent]]++;
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Merge the group greedily.
+         * @param group The supernodes of the group
+         * @param threshold The minimum saving to merge
+         * @param rng The random generator to pick the supernodes
+         * @return The pairs of merged supernodes
+         */
+        std::vector<std::pair<int, int>> merge(std::vector<int> group, double threshold, std::mt19937_64 &rng) {
+            std::vector<std::pair<int, int>> merges;
+            std::shuffle(group.begin(), group.end(), rng);
+            while (group.size() > 1) {
+                const int first = group.back();
+                group.pop_back();
+
+                size_t best = 0;
+                double bestSimilarity = -1.0;
+                for (size_t i = 0; i < group.size(); i++) {
+                    const double value = similarity(counts[first], counts[group[i]]);
+                    if (value > bestSimilarity) {
+                        bestSimilarity = value;
+                        best = i;
+                    }
+                }
+                const int second = group[best];
+
+                const int64_t separateCost = cost(first, first, sizes[first], {&counts[first]}) + cost(second, second, sizes[second], {&counts[second]});
+                if (separateCost == 0) {
+                    continue;
+                }
+                const int64_t mergedCost = cost(second, first, sizes[first] + sizes[second], {&counts[first], &counts[second]});
+                const double saving = 1.0 - static_cast<double>(mergedCost) / separateCost;
+                if (saving < threshold) {
+                    continue;
+                }
+
+                // the merged supernode stays in the group as second
+                for (const auto &[adjacent, count] : counts[first]) {
+                    counts[second][adjacent] += count;
+                }
+                counts.erase(first);
+                sizes[second] += sizes[first];
+                sizes.erase(first);
+                representatives[first] = second;
+                merges.emplace_back(first, second);
+            }
+            return merges;
+        }
+    };
+
+    /**
+     * @brief Group the supernodes by the min-hash shingle of the nodes and their adjacent nodes.
+     * @param seeds The seed of the random generator of each group
+     */
+    std::vector<std::vector<int>> groupByShingle(const CompressedGraph &graph, const Supernodes &supernodes, uint64_t salt, int numThreads, std::vector<uint64_t> &seeds) {
+        std::vector<int> ids;
+        ids.reserve(supernodes.members.size());
+        for (const auto &[id, _] : supernodes.members) {
+            ids.push_back(id);
+        }
+        std::sort(ids.begin(), ids.end());
+
+        auto hash = [salt](int index) {
+            return mix(static_cast<uint64_t>(index) ^ salt);
+        };
+        std::vector<std::tuple<uint64_t, uint64_t, int>> shingles(ids.size());
+        parallel::parallelFor(0, ids.size(), numThreads, [&](size_t i) {
+            uint64_t shingle = std::numeric_limits<uint64_t>::max();
+            int minNode = std::numeric_limits<int>::max();
+            for (const int node : supernodes.members.at(ids[i])) {
+                minNode = std::min(minNode, node);
+                shingle = std::min(shingle, hash(node));
+                for (const int adjacent : graph.getAdjacents(node)) {
+                    shingle = std::min(shingle, hash(adjacent));
+                }
+            }
+            // the second key shuffles the supernodes within a shingle before splitting large groups,
+            // it is derived from the nodes since the ids of new supernodes depend on the other graphs in the process
+            shingles[i] = {shingle, mix(static_cast<uint64_t>(minNode) ^ ~salt), ids[i]};
+        });
+        std::sort(shingles.begin(), shingles.end());
+
+        std::vector<std::vector<int>> groups;
+        for (size_t begin = 0; begin < shingles.size();) {
+            size_t end = begin + 1;
+            while (end < shingles.size() && std::get<0>(shingles[end]) == std::get<0>(shingles[begin]) && end - begin < maxGroupSize) {
+                end++;
+            }
+            if (end - begin >= 2) {
+                seeds.push_back(std::get<1>(shingles[begin]));
+                std::vector<int> group;
+                group.reserve(end - begin);
+                for (size_t i = begin; i < end; i++) {
+                    group.push_back(std::get<2>(shingles[i]));
+                }
+                groups.push_back(std::move(group));
+            }
+            begin = end;
+        }
+        return groups;
+    }
+
+    template <typename GraphType>
+    graph_structure::WeightedSupergraph summarizeGraph(const GraphType &graph, int iterations, int numThreads) {
+        if (iterations < 0) {
+            throw std::invalid_argument("iterations must be greater than or equal to 0");
+        }
+
+        // the nodes and edges of the graph are the leaves of the hierarchy
+        graph_structure::WeightedSupergraph summary;
+        for (const int id : graph.getIdRange()) {
+            summary.setNode(id);
+        }
+        for (const auto &edge : graph.getEdges(true)) {
+            if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(edge)>> == 3) {
+                summary.setEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+            } else {
+                summary.setEdge(std::get<0>(edge), std::get<1>(edge), 1.0);
+            }
+        }
+
+        const CompressedGraph compressed(graph);
+        Supernodes supernodes;
+        supernodes.supernodeOf.resize(compressed.size());
+        for (size_t i = 0; i < compressed.size(); i++) {
+            supernodes.supernodeOf[i] = compressed.getId(i);
+            supernodes.members[compressed.getId(i)] = {static_cast<int>(i)};
+        }
+
+        for (int iteration = 1; iteration <= iterations; iteration++) {
+            const double threshold = iteration < iterations ? 1.0 / (1 + iteration) : 0.0;
+            const uint64_t salt = mix(seed + iteration);
+            std::vector<uint64_t> seeds;
+            const std::vector<std::vector<int>> groups = groupByShingle(compressed, supernodes, salt, numThreads, seeds);
+
+            std::vector<std::vector<std::pair<int, int>>> groupMerges(groups.size());
+            parallel::parallelFor(0, groups.size(), numThreads, [&](size_t i) {
+                std::mt19937_64 rng(seeds[i]);
+                GroupMerger merger(compressed, supernodes, groups[i]);
+                groupMerges[i] = merger.merge(groups[i], threshold, rng);
+            });
+
+            std::vector<std::pair<int, int>> pairs;
+            for (const auto &merges : groupMerges) {
+                pairs.insert(pairs.end(), merges.begin(), merges.end());
+            }
+            if (pairs.empty()) {
+                continue;
+            }
+            for (const auto &[member, supernode] : summary.mergeNodes(pairs)) {
+                std::vector<int> &merged = supernodes.members[supernode];
+                for (const int node : supernodes.members.at(member)) {
+                    supernodes.supernodeOf[node] = supernode;
+                    merged.push_back(node);
+                }
+                supernodes.members.erase(member);
+            }
+            spdlog::debug("iteration {}: {} groups, {} supernodes", iteration, groups.size(), supernodes.members.size());
+        }
+        return summary;
+    }
+}
+
+namespace anagraph {
+namespace summarization {
+
+graph_structure::WeightedSupergraph summarize(const graph_structure::Graph &graph) {
+    return summarize(graph, defaultIterations, 1);
+}
+
+graph_structure::WeightedSupergraph summarize(const graph_structure::Graph &graph, int iterations) {
+    return summarize(graph, iterations, 1);
+}
+
+graph_structure::WeightedSupergraph summarize(const graph_structure::Graph &graph, int iterations, int numThreads) {
+    return summarizeGraph(graph, iterations, numThreads);
+}
+
+graph_structure::WeightedSupergraph summarize(const graph_structure::WeightedGraph &graph) {
+    return summarize(graph, defaultIterations, 1);
+}
+
+graph_structure::WeightedSupergraph summarize(const graph_structure::WeightedGraph &graph, int iterations) {
+    return summarize(graph, iterations, 1);
+}
+
+graph_structure::WeightedSupergraph summarize(const graph_structure::WeightedGraph &graph, int iterations, int numThreads) {
+    return summarizeGraph(graph, iterations, numThreads);
+}
+
+} // namespace summarization
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "anagraph/algorithms/summary_query.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <deque>
+#include <span>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::WeightedSupernode;
+
+    template <typename GraphType>
+    int rootOf(const GraphType &graph, int id) {
+        return graph.getHierarchyIndex().getRoot(id);
+    }
+
+    template <typename GraphType>
+    bool isRoot(const GraphType &graph, int id) {
+        return graph.getParent(id) == WeightedSupernode::ROOT;
+    }
+
+    template <typename GraphType>
+    std::span<const int> getLeaves(const GraphType &graph, int supernode) {
+        return graph.getHierarchyIndex().getLeaves(supernode);
+    }
+
+    template <bool isUndirected, typename GraphType>
+    std::unordered_map<int, double> pushOnSummary(const GraphType &graph, const std::unordered_map<int, double> &source, const double alpha, const double thr) {
+        // the source is lifted to the root supernodes
+        std::unordered_map<int, double> restart;
+        double sourceSum = 0.0;
+        for (const auto &[id, score] : source) {
+            if (score > 0) {
+                restart[rootOf(graph, id)] += score;
+                sourceSum += score;
+            }
+        }
+        if (sourceSum == 0) {
+            throw std::invalid_argument("The source vector must have at least one non-zero element");
+        }
+        for (auto &[_, score] : restart) {
+            score /= sourceSum;
+        }
+
+        std::unordered_map<int, double> ppr;
+        std::unordered_map<int, double> residue = restart;
+        std::deque<int> queue;
+        std::unordered_set<int> queued;
+        for (const auto &[supernode, score] : restart) {
+            if (score >= thr) {
+                queue.push_back(supernode);
+                queued.insert(supernode);
+            }
+        }
+        auto addResidue = [&](int supernode, double value) {
+            double &current = residue[supernode];
+            current += value;
+            if (current >= thr && !queued.contains(supernode)) {
+                queue.push_back(supernode);
+                queued.insert(supernode);
+            }
+        };
+
+        std::vector<std::pair<int, double>> superedges;
+        while (!queue.empty()) {
+            const int current = queue.front();
+            queue.pop_front();
+            queued.erase(current);
+            const double currentResidue = residue[current];
+            if (currentResidue < thr) {
+                continue;
+            }
+            residue[current] = 0;
+            ppr[current] += alpha * currentResidue;
+
+            // the edges to lower levels are kept for the hierarchy, and are not a part of the summary
+            // an undirected self loop of a supernode stores each edge between its leaves once,
+            // but the edge adds to the degrees of both leaves, so the walk stays with twice its weight
+            const bool isSupernode = isUndirected && graph.getHierarchyIndex().getLeafCount(current) > 1;
+            superedges.clear();
+            double weightSum = 0.0;
+            for (const auto &[dst, weight] : graph.getAdjacents(current)) {
+                if (isRoot(graph, dst)) {
+                    const double degreeWeight = isSupernode && dst == current ? 2 * weight : weight;
+                    superedges.emplace_back(dst, degreeWeight);
+                    weightSum += degreeWeight;
+                }
+            }
+            if (weightSum <= 0) {
+                // dangling supernode
+                for (const auto &[src, srcWeight] : restart) {
+                    addResidue(src, (1 - alpha) * srcWeight * currentResidue);
+                }
+                continue;
+            }
+            for (const auto &[dst, weight] : superedges) {
+                addResidue(dst, (1 - alpha) * (weight / weightSum) * currentResidue);
+            }
+        }
+        spdlog::debug("forward push visited {} supernodes", residue.size());
+        return ppr;
+    }
+
+    template <typename GraphType>
+    std::unordered_map<int, double> expandSupernode(const GraphType &graph, const std::unordered_map<int, double> &scores, int supernode) {
+        const std::span<const int> leaves = getLeaves(graph, supernode);
+        const auto it = scores.find(supernode);
+        const double score = it == scores.end() ? 0.0 : it->second / leaves.size();
+        std::unordered_map<int, double> result;
+        for (const int leaf : leaves) {
+            result[leaf] = score;
+        }
+        return result;
+    }
+
+    template <bool isUndirected, typename GraphType>
+    std::vector<std::pair<int, double>> supernodeNeighbors(const GraphType &graph, int id) {
+        const int root = rootOf(graph, id);
+        const graph_structure::HierarchyIndex &index = graph.getHierarchyIndex();
+        auto leafCount = [&](int supernode) {
+            return static_cast<double>(index.getLeafCount(supernode));
+        };
+
+        std::vector<std::pair<int, double>> neighbors;
+        const double rootSize = leafCount(root);
+        for (const auto &[dst, weight] : graph.getAdjacents(root)) {
+            if (!isRoot(graph, dst)) {
+                continue;
+            }
+            double pairs;
+            if (dst == root) {
+                pairs = isUndirected ? rootSize * (rootSize - 1) / 2 : rootSize * (rootSize - 1);
+                // a self loop of a single node
+                pairs = std::max(pairs, 1.0);
+            } else {
+                pairs = rootSize * leafCount(dst);
+            }
+            neighbors.emplace_back(dst, weight / pairs);
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        return neighbors;
+    }
+
+    template <bool isUndirected, typename GraphType>
+    std::vector<int> neighborLeaves(const GraphType &graph, int id, double minDensity) {
+        std::vector<int> neighbors;
+        for (const auto &[supernode, density] : supernodeNeighbors<isUndirected>(graph, id)) {
+            if (density < minDensity) {
+                continue;
+            }
+            for (const int leaf : getLeaves(graph, supernode)) {
+                if (leaf != id) {
+                    neighbors.push_back(leaf);
+                }
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        return neighbors;
+    }
+}
+
+namespace anagraph {
+namespace summary_query {
+
+std::unordered_map<int, double> forwardPush(const graph_structure::WeightedSuperDigraph &graph, const std::unordered_map<int, double> &source, const double alpha, const double thr) {
+    return pushOnSummary<false>(graph, source, alpha, thr);
+}
+
+std::unordered_map<int, double> forwardPush(const graph_structure::WeightedSupergraph &graph, const std::unordered_map<int, double> &source, const double alpha, const double thr) {
+    return pushOnSummary<true>(graph, source, alpha, thr);
+}
+
+std::unordered_map<int, double> expand(const graph_structure::WeightedSuperDigraph &graph, const std::unordered_map<int, double> &scores, int supernode) {
+    return expandSupernode(graph, scores, supernode);
+}
+
+std::unordered_map<int, double> expand(const graph_structure::WeightedSupergraph &graph, const std::unordered_map<int, double> &scores, int supernode) {
+    return expandSupernode(graph, scores, supernode);
+}
+
+std::vector<std::pair<int, double>> getSupernodeNeighbors(const graph_structure::WeightedSuperDigraph &graph, int id) {
+    return supernodeNeighbors<false>(graph, id);
+}
+
+std::vector<std::pair<int, double>> getSupernodeNeighbors(const graph_structure::WeightedSupergraph &graph, int id) {
+    return supernodeNeighbors<true>(graph, id);
+}
+
+std::vector<int> getNeighbors(const graph_structure::WeightedSuperDigraph &graph, int id, double minDensity) {
+    return neighborLeaves<false>(graph, id, minDensity);
+}
+
+std::vector<int> getNeighbors(const graph_structure::WeightedSupergraph &graph, int id, double minDensity) {
+    return neighborLeaves<true>(graph, id, minDensity);
+}
+
+} // namespace summary_query
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,304 @@
+#include "anagraph/algorithms/triangles.hpp"
+
+#include "anagraph/algorithms/vector_kernels.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+
+namespace {
+    using namespace anagraph;
+    using graph_structure::CompressedGraph;
+
+    // the samples are drawn in chunks, each from its own seed, so that the result does not depend on the threads
+    constexpr size_t SAMPLE_CHUNK = 1024;
+    constexpr uint64_t SAMPLE_SEED = 1190494759;
+
+    /**
+     * @struct Orientation
+     * @brief The out-neighbors of each node, oriented from the smaller degree to the larger one.
+     */
+    struct Orientation {
+        std::vector<size_t> offsets;
+        std::vector<int> targets;
+
+        std::span<const int> getAdjacents(size_t node) const {
+            return std::span<const int>(targets.data() + offsets[node], offsets[node + 1] - offsets[node]);
+        }
+    };
+
+    bool isHigher(const CompressedGraph &graph, int first, int second) {
+        const size_t firstDegree = graph.getDegree(first);
+        const size_t secondDegree = graph.getDegree(second);
+        return firstDegree > secondDegree || (firstDegree == secondDegree && first > second);
+    }
+
+    Orientation orient(const CompressedGraph &graph, int numThreads) {
+        const size_t size = graph.size();
+        Orientation orientation;
+        orientation.offsets.resize(size + 1, 0);
+        parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+            const auto adjacents = graph.getAdjacents(node);
+            orientation.offsets[node + 1] = std::count_if(adjacents.begin(), adjacents.end(), [&](int adjacent) {
+                return isHigher(graph, adjacent, node);
+            });
+        });
+        for (size_t node = 0; node < size; node++) {
+            orientation.offsets[node + 1] += orientation.offsets[node];
+        }
+        orientation.targets.resize(orientation.offsets[size]);
+        // the filtered neighbors remain sorted by the index
+        parallel::parallelFor(0, size, numThreads, [&](size_t node) {
+            const auto adjacents = graph.getAdjacents(node);
+            std::copy_if(adjacents.begin(), adjacents.end(), orientation.targets.begin() + orientation.offsets[node], [&](int adjacent) {
+                return isHigher(graph, adjacent, node);
+            });
+        });
+        return orientation;
+    }
+
+    /**
+     * @brief Get the number of the neighbors of a node other than itself.
+     */
+    size_t simpleDegree(const CompressedGraph &graph, int node) {
+        const auto adjacents = graph.getAdjacents(node);
+        return adjacents.size() - (std::binary_search(adjacents.begin(), adjacents.end(), node) ? 1 : 0);
+    }
+
+    /**
+     * @brief Get the k-th neighbor of a node other than itself.
+     */
+    int simpleAdjacent(const CompressedGraph &graph, int node, size_t k) {
+        const auto adjacents = graph.getAdjacents(node);
+        const size_t selfLoop = std::lower_bound(adjacents.begin(), adjacents.end(), node) - adjacents.begin();
+        return adjacents[k + ((k >= selfLoop && selfLoop < adjacents.size() && adjacents[selfLoop] == node) ? 1 : 0)];
+    }
+
+    /**
+     * @brief Sample 2 distinct neighbors of a center, and check if they are connected.
+     */
+    bool isClosedWedge(const CompressedGraph &graph, int center, size_t degree, std::mt19937_64 &engine) {
+        const size_t first = std::uniform_int_distribution<size_t>(0, degree - 1)(engine);
+        size_t second = std::uniform_int_distribution<size_t>(0, degree - 2)(engine);
+        second += second >= first ? 1 : 0;
+        const int firstAdjacent = simpleAdjacent(graph, center, first);
+        const auto adjacents = graph.getAdjacents(firstAdjacent);
+        return std::binary_search(adjacents.begin(), adjacents.end(), simpleAdjacent(graph, center, second));
+    }
+
+    void validateSamples(size_t samples) {
+        if (samples == 0) {
+            throw std::invalid_argument("samples must be positive");
+        }
+    }
+
+    /**
+     * @brief Count the closed wedges among the samples, drawing each chunk of the samples from its own engine.
+     * @param sampleWedge The function to sample a wedge by an engine, returning whether it is closed
+     */
+    template <typename SampleWedge>
+    size_t countClosedWedges(size_t samples, int numThreads, SampleWedge &&sampleWedge) {
+        const size_t chunks = (samples + SAMPLE_CHUNK - 1) / SAMPLE_CHUNK;
+        std::vector<size_t> closedCounts(chunks, 0);
+        parallel::parallelFor(0, chunks, std::max(1, numThreads), [&](size_t chunk) {
+            std::mt19937_64 engine(SAMPLE_SEED + chunk);
+            const size_t chunkEnd = std::min(samples, (chunk + 1) * SAMPLE_CHUNK);
+            for (size_t i = chunk * SAMPLE_CHUNK; i < chunkEnd; i++) {
+                closedCounts[chunk] += sampleWedge(engine) ? 1 : 0;
+            }
+        });
+        size_t closedCount = 0;
+        for (const size_t count : closedCounts) {
+            closedCount += count;
+        }
+        return closedCount;
+    }
+}
+
+namespace anagraph {
+namespace triangles {
+
+size_t countTriangles(const graph_structure::Graph &graph) {
+    return countTriangles(graph, 1);
+}
+
+size_t countTriangles(const graph_structure::Graph &graph, int numThreads) {
+    return countTriangles(graph_structure::CompressedGraph(graph), numThreads);
+}
+
+size_t countTriangles(const graph_structure::WeightedGraph &graph) {
+    return countTriangles(graph, 1);
+}
+
+size_t countTriangles(const graph_structure::WeightedGraph &graph, int numThreads) {
+    return countTriangles(graph_structure::CompressedGraph(graph), numThreads);
+}
+
+size_t countTriangles(const graph_structure::CompressedGraph &graph, int numThreads) {
+    const int threads = std::max(1, numThreads);
+    const Orientation orientation = orient(graph, threads);
+    std::vector<size_t> counts(graph.size(), 0);
+    parallel::parallelFor(0, graph.size(), threads, [&](size_t src) {
+        const auto srcAdjacents = orientation.getAdjacents(src);
+        for (const int dst : srcAdjacents) {
+            const auto dstAdjacents = orientation.getAdjacents(dst);
+            counts[src] += kernels::intersectionSize(srcAdjacents.data(), srcAdjacents.size(), dstAdjacents.data(), dstAdjacents.size());
+        }
+    });
+    size_t count = 0;
+    for (const size_t nodeCount : counts) {
+        count += nodeCount;
+    }
+    spdlog::debug("found {} triangles along {} oriented edges", count, orientation.targets.size());
+    return count;
+}
+
+std::vector<size_t> countNodeTriangles(const graph_structure::CompressedGraph &graph, int numThreads) {
+    const size_t size = graph.size();
+    const int threads = std::max(1, numThreads);
+    const Orientation orientation = orient(graph, threads);
+    std::vector<size_t> counts(size, 0);
+    if (size == 0) {
+        return counts;
+    }
+
+    // each block marks the out-neighbors of its nodes in its own flags
+    const size_t blocks = std::min(static_cast<size_t>(threads), size);
+    const size_t blockSize = (size + blocks - 1) / blocks;
+    parallel::parallelFor(0, blocks, threads, [&](size_t block) {
+        std::vector<bool> isMarked(size, false);
+        const size_t blockEnd = std::min(size, (block + 1) * blockSize);
+        for (size_t src = block * blockSize; src < blockEnd; src++) {
+            const auto srcAdjacents = orientation.getAdjacents(src);
+            for (const int dst : srcAdjacents) {
+                isMarked[dst] = true;
+            }
+            size_t srcCount = 0;
+            for (const int dst : srcAdjacents) {
+                size_t dstCount = 0;
+                for (const int third : orientation.getAdjacents(dst)) {
+                    if (isMarked[third]) {
+                        std::atomic_ref<size_t>(counts[third]).fetch_add(1, std::memory_order_relaxed);
+                        dstCount++;
+                    }
+                }
+                if (dstCount > 0) {
+                    std::atomic_ref<size_t>(counts[dst]).fetch_add(dstCount, std::memory_order_relaxed);
+                    srcCount += dstCount;
+                }
+            }
+            if (srcCount > 0) {
+                std::atomic_ref<size_t>(counts[src]).fetch_add(srcCount, std::memory_order_relaxed);
+            }
+            for (const int dst : srcAdjacents) {
+                isMarked[dst] = false;
+            }
+        }
+    });
+    return counts;
+}
+
+std::vector<double> clusteringCoefficients(const graph_structure::Graph &graph) {
+    return clusteringCoefficients(graph, 1);
+}
+
+std::vector<double> clusteringCoefficients(const graph_structure::Graph &graph, int numThreads) {
+    return clusteringCoefficients(graph_structure::CompressedGraph(graph), numThreads);
+}
+
+std::vector<double> clusteringCoefficients(const graph_structure::WeightedGraph &graph) {
+    return clusteringCoefficients(graph, 1);
+}
+
+std::vector<double> clusteringCoefficients(const graph_structure::WeightedGraph &graph, int numThreads) {
+    return clusteringCoefficients(graph_structure::CompressedGraph(graph), numThreads);
+}
+
+std::vector<double> clusteringCoefficients(const graph_structure::CompressedGraph &graph, int numThreads) {
+    const std::vector<size_t> counts = countNodeTriangles(graph, numThreads);
+    std::vector<double> coefficients(graph.size(), 0.0);
+    for (size_t node = 0; node < graph.size(); node++) {
+        const size_t degree = simpleDegree(graph, node);
+        if (degree >= 2) {
+            coefficients[node] = 2.0 * counts[node] / (static_cast<double>(degree) * (degree - 1));
+        }
+    }
+    return coefficients;
+}
+
+double estimateTriangles(const graph_structure::Graph &graph, size_t samples) {
+    return estimateTriangles(graph, samples, 1);
+}
+
+double estimateTriangles(const graph_structure::Graph &graph, size_t samples, int numThreads) {
+    return estimateTriangles(graph_structure::CompressedGraph(graph), samples, numThreads);
+}
+
+double estimateTriangles(const graph_structure::WeightedGraph &graph, size_t samples) {
+    return estimateTriangles(graph, samples, 1);
+}
+
+double estimateTriangles(const graph_structure::WeightedGraph &graph, size_t samples, int numThreads) {
+    return estimateTriangles(graph_structure::CompressedGraph(graph), samples, numThreads);
+}
+
+double estimateTriangles(const graph_structure::CompressedGraph &graph, size_t samples, int numThreads) {
+    validateSamples(samples);
+    // the cumulative number of the wedges, to sample the center of a wedge by binary search
+    std::vector<size_t> degrees(graph.size());
+    std::vector<size_t> cumulativeWedges(graph.size() + 1, 0);
+    for (size_t node = 0; node < graph.size(); node++) {
+        degrees[node] = simpleDegree(graph, node);
+        cumulativeWedges[node + 1] = cumulativeWedges[node] + (degrees[node] < 2 ? 0 : degrees[node] * (degrees[node] - 1) / 2);
+    }
+    const size_t wedgeCount = cumulativeWedges.back();
+    if (wedgeCount == 0) {
+        return 0.0;
+    }
+
+    const size_t closedCount = countClosedWedges(samples, numThreads, [&](std::mt19937_64 &engine) {
+        const size_t wedge = std::uniform_int_distribution<size_t>(0, wedgeCount - 1)(engine);
+        const int center = std::upper_bound(cumulativeWedges.begin(), cumulativeWedges.end(), wedge) - cumulativeWedges.begin() - 1;
+        return isClosedWedge(graph, center, degrees[center], engine);
+    });
+    spdlog::debug("{} of {} sampled wedges are closed among {} wedges", closedCount, samples, wedgeCount);
+    return static_cast<double>(closedCount) / samples * wedgeCount / 3;
+}
+
+double estimateAverageClustering(const graph_structure::Graph &graph, size_t samples) {
+    return estimateAverageClustering(graph, samples, 1);
+}
+
+double estimateAverageClustering(const graph_structure::Graph &graph, size_t samples, int numThreads) {
+    return estimateAverageClustering(graph_structure::CompressedGraph(graph), samples, numThreads);
+}
+
+double estimateAverageClustering(const graph_structure::WeightedGraph &graph, size_t samples) {
+    return estimateAverageClustering(graph, samples, 1);
+}
+
+double estimateAverageClustering(const graph_structure::WeightedGraph &graph, size_t samples, int numThreads) {
+    return estimateAverageClustering(graph_structure::CompressedGraph(graph), samples, numThreads);
+}
+
+double estimateAverageClustering(const graph_structure::CompressedGraph &graph, size_t samples, int numThreads) {
+    validateSamples(samples);
+    if (graph.size() == 0) {
+        return 0.0;
+    }
+    const size_t closedCount = countClosedWedges(samples, numThreads, [&](std::mt19937_64 &engine) {
+        const int center = std::uniform_int_distribution<size_t>(0, graph.size() - 1)(engine);
+        const size_t degree = simpleDegree(graph, center);
+        return degree >= 2 && isClosedWedge(graph, center, degree, engine);
+    });
+    return static_cast<double>(closedCount) / samples;
+}
+
+} // namespace triangles
+} // namespace anagraph
\ No newline at end of file
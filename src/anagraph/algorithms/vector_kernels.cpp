@@ -0,0 +1,232 @@
+#include "anagraph/algorithms/vector_kernels.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#ifdef ANAGRAPH_X86_KERNELS
+// defined in vector_kernels_avx2.cpp and vector_kernels_avx512.cpp, which are compiled with their own flags
+namespace anagraph {
+namespace kernels {
+namespace avx2 {
+    double dot(const double *v1, const double *v2, size_t size);
+    DotProducts dotAndNorms(const double *v1, const double *v2, size_t size);
+    bool klDivergence(const double *p, const double *q, size_t size, double &result);
+    double jsDivergence(const double *p, const double *q, size_t size);
+    size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB);
+} // namespace avx2
+namespace avx512 {
+    double dot(const double *v1, const double *v2, size_t size);
+    DotProducts dotAndNorms(const double *v1, const double *v2, size_t size);
+    bool klDivergence(const double *p, const double *q, size_t size, double &result);
+    double jsDivergence(const double *p, const double *q, size_t size);
+    size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB);
+} // namespace avx512
+} // namespace kernels
+} // namespace anagraph
+#endif
+
+namespace {
+    using namespace anagraph::kernels;
+
+    SimdLevel detectSimdLevel() {
+#ifdef ANAGRAPH_X86_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SimdLevel::AVX2;
+        }
+#endif
+        return SimdLevel::SCALAR;
+    }
+
+    void checkSupported(SimdLevel level) {
+        if (!isSupported(level)) {
+            throw std::invalid_argument("The instruction set is not supported");
+        }
+    }
+
+    [[noreturn]] void throwZeroQ() {
+        throw std::invalid_argument("q must not contain 0.0 when p contains non-zero value");
+    }
+
+    double scalarDot(const double *v1, const double *v2, size_t size) {
+        double dot = 0.0;
+        for (size_t i = 0; i < size; i++) {
+            dot += v1[i] * v2[i];
+        }
+        return dot;
+    }
+
+    DotProducts scalarDotAndNorms(const double *v1, const double *v2, size_t size) {
+        DotProducts products{0.0, 0.0, 0.0};
+        for (size_t i = 0; i < size; i++) {
+            products.dot += v1[i] * v2[i];
+            products.squaredNorm1 += v1[i] * v1[i];
+            products.squaredNorm2 += v2[i] * v2[i];
+        }
+        return products;
+    }
+
+    double scalarKlDivergence(const double *p, const double *q, size_t size) {
+        double kl = 0.0;
+        for (size_t i = 0; i < size; i++) {
+            if (p[i] == 0.0) {
+                continue;
+            }
+            if (q[i] == 0.0) {
+                throwZeroQ();
+            }
+            kl += p[i] * std::log2(p[i] / q[i]);
+        }
+        return kl;
+    }
+
+    double scalarJsDivergence(const double *p, const double *q, size_t size) {
+        double js = 0.0;
+        for (size_t i = 0; i < size; i++) {
+            const double m = (p[i] + q[i]) / 2;
+            if (p[i] != 0.0) {
+                js += p[i] * std::log2(p[i] / m);
+            }
+            if (q[i] != 0.0) {
+                js += q[i] * std::log2(q[i] / m);
+            }
+        }
+        return js / 2;
+    }
+
+    size_t scalarIntersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB) {
+        size_t count = 0;
+        size_t i = 0;
+        size_t j = 0;
+        // the branchless merge, since the comparison is hard to predict
+        while (i < sizeA && j < sizeB) {
+            const int x = a[i];
+            const int y = b[j];
+            count += x == y;
+            i += x <= y;
+            j += y <= x;
+        }
+        return count;
+    }
+}
+
+namespace anagraph {
+namespace kernels {
+
+SimdLevel getSimdLevel() {
+    static const SimdLevel level = [] {
+        const SimdLevel detected = detectSimdLevel();
+        spdlog::debug("vector kernels use the instruction set {}", static_cast<int>(detected));
+        return detected;
+    }();
+    return level;
+}
+
+bool isSupported(SimdLevel level) {
+    return static_cast<int>(level) <= static_cast<int>(getSimdLevel());
+}
+
+double dot(const double *v1, const double *v2, size_t size) {
+    return dot(v1, v2, size, getSimdLevel());
+}
+
+double dot(const double *v1, const double *v2, size_t size, SimdLevel level) {
+    checkSupported(level);
+    switch (level) {
+#ifdef ANAGRAPH_X86_KERNELS
+    case SimdLevel::AVX512:
+        return avx512::dot(v1, v2, size);
+    case SimdLevel::AVX2:
+        return avx2::dot(v1, v2, size);
+#endif
+    default:
+        return scalarDot(v1, v2, size);
+    }
+}
+
+DotProducts dotAndNorms(const double *v1, const double *v2, size_t size) {
+    return dotAndNorms(v1, v2, size, getSimdLevel());
+}
+
+DotProducts dotAndNorms(const double *v1, const double *v2, size_t size, SimdLevel level) {
+    checkSupported(level);
+    switch (level) {
+#ifdef ANAGRAPH_X86_KERNELS
+    case SimdLevel::AVX512:
+        return avx512::dotAndNorms(v1, v2, size);
+    case SimdLevel::AVX2:
+        return avx2::dotAndNorms(v1, v2, size);
+#endif
+    default:
+        return scalarDotAndNorms(v1, v2, size);
+    }
+}
+
+double klDivergence(const double *p, const double *q, size_t size) {
+    return klDivergence(p, q, size, getSimdLevel());
+}
+
+double klDivergence(const double *p, const double *q, size_t size, SimdLevel level) {
+    checkSupported(level);
+    double kl = 0.0;
+    switch (level) {
+#ifdef ANAGRAPH_X86_KERNELS
+    case SimdLevel::AVX512:
+        if (!avx512::klDivergence(p, q, size, kl)) {
+            throwZeroQ();
+        }
+        return kl;
+    case SimdLevel::AVX2:
+        if (!avx2::klDivergence(p, q, size, kl)) {
+            throwZeroQ();
+        }
+        return kl;
+#endif
+    default:
+        return scalarKlDivergence(p, q, size);
+    }
+}
+
+double jsDivergence(const double *p, const double *q, size_t size) {
+    return jsDivergence(p, q, size, getSimdLevel());
+}
+
+double jsDivergence(const double *p, const double *q, size_t size, SimdLevel level) {
+    checkSupported(level);
+    switch (level) {
+#ifdef ANAGRAPH_X86_KERNELS
+    case SimdLevel::AVX512:
+        return avx512::jsDivergence(p, q, size);
+    case SimdLevel::AVX2:
+        return avx2::jsDivergence(p, q, size);
+#endif
+    default:
+        return scalarJsDivergence(p, q, size);
+    }
+}
+
+size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB) {
+    return intersectionSize(a, sizeA, b, sizeB, getSimdLevel());
+}
+
+size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB, SimdLevel level) {
+    checkSupported(level);
+    switch (level) {
+#ifdef ANAGRAPH_X86_KERNELS
+    case SimdLevel::AVX512:
+        return avx512::intersectionSize(a, sizeA, b, sizeB);
+    case SimdLevel::AVX2:
+        return avx2::intersectionSize(a, sizeA, b, sizeB);
+#endif
+    default:
+        return scalarIntersectionSize(a, sizeA, b, sizeB);
+    }
+}
+
+} // namespace kernels
+} // namespace anagraph
\ No newline at end of file
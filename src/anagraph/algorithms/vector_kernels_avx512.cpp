@@ -0,0 +1,31 @@
+// compiled with -mavx512f, called only when the CPU supports it
+#define ANAGRAPH_SIMD_WIDTH 8
+#include "vector_kernels_simd.hpp"
+
+namespace anagraph {
+namespace kernels {
+namespace avx512 {
+
+double dot(const double *v1, const double *v2, size_t size) {
+    return dotKernel(v1, v2, size);
+}
+
+DotProducts dotAndNorms(const double *v1, const double *v2, size_t size) {
+    return dotAndNormsKernel(v1, v2, size);
+}
+
+bool klDivergence(const double *p, const double *q, size_t size, double &result) {
+    return klKernel(p, q, size, result);
+}
+
+double jsDivergence(const double *p, const double *q, size_t size) {
+    return jsKernel(p, q, size);
+}
+
+size_t intersectionSize(const int *a, size_t sizeA, const int *b, size_t sizeB) {
+    return intersectionKernel(a, sizeA, b, sizeB);
+}
+
+} // namespace avx512
+} // namespace kernels
+} // namespace anagraph
\ No newline at end of file
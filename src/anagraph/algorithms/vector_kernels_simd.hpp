@@ -0,0 +1,230 @@
+#pragma once
+
+#ifndef VECTOR_KERNELS_SIMD_HPP
+#define VECTOR_KERNELS_SIMD_HPP
+
+#include "anagraph/algorithms/vector_kernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef ANAGRAPH_SIMD_WIDTH
+#error "ANAGRAPH_SIMD_WIDTH must be defined before including vector_kernels_simd.hpp"
+#endif
+
+/*
+ * The kernels written with the vector extension of GCC and Clang.
+ *
+ * This header is included by one translation unit per instruction set, compiled with the flags of that set.
+ * Everything is in an anonymous namespace and avoids the standard library,
+ * so that no inline function compiled for a wider instruction set is shared with the rest of the library.
+ */
+namespace {
+    constexpr size_t width = ANAGRAPH_SIMD_WIDTH;
+    typedef double VDouble __attribute__((vector_size(width * sizeof(double))));
+    typedef int64_t VInt __attribute__((vector_size(width * sizeof(double))));
+    // the lanes of the indices, twice as many as the lanes of double
+    constexpr size_t indexWidth = width * sizeof(double) / sizeof(int);
+    typedef int VIndex __attribute__((vector_size(width * sizeof(double))));
+
+    constexpr double minNormal = 2.2250738585072014e-308;
+
+    inline VDouble load(const double *ptr) {
+        VDouble v;
+        __builtin_memcpy(&v, ptr, sizeof(v));
+        return v;
+    }
+
+    /**
+     * @brief Load the last count (< width) elements, filling the rest with padding.
+     */
+    inline VDouble loadPartial(const double *ptr, size_t count, double padding) {
+        double buffer[width];
+        for (size_t i = 0; i < width; i++) {
+            buffer[i] = i < count ? ptr[i] : padding;
+        }
+        return load(buffer);
+    }
+
+    inline VDouble broadcast(double value) {
+        return VDouble{} + value;
+    }
+
+    inline double sum(VDouble v) {
+        double total = 0.0;
+        for (size_t i = 0; i < width; i++) {
+            total += v[i];
+        }
+        return total;
+    }
+
+    inline bool any(VInt mask) {
+        for (size_t i = 0; i < width; i++) {
+            if (mask[i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline VDouble select(VInt mask, VDouble ifTrue, VDouble ifFalse) {
+        return (VDouble)(((VInt)ifTrue & mask) | ((VInt)ifFalse & ~mask));
+    }
+
+    /**
+     * @brief Calculate log2 of positive normal numbers.
+     *
+     * x = 2^e * m with m in [sqrt(1/2), sqrt(2)), and ln(m) = 2 atanh(s) with s = (m - 1) / (m + 1),
+     * whose series converges to double precision within 12 terms since |s| < 0.172.
+     */
+    inline VDouble log2Normal(VDouble x) {
+        const VInt bits = (VInt)x;
+        VInt exponent = ((bits >> 52) & 0x7ff) - 1023;
+        VDouble m = (VDouble)((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+        const VInt isLarge = m > 1.4142135623730951;
+        m = select(isLarge, m * 0.5, m);
+        exponent -= isLarge; // isLarge is -1 where true
+
+        const VDouble s = (m - 1.0) / (m + 1.0);
+        const VDouble s2 = s * s;
+        VDouble series = broadcast(1.0 / 23);
+        for (int k = 10; k >= 0; k--) {
+            series = series * s2 + 1.0 / (2 * k + 1);
+        }
+        return __builtin_convertvector(exponent, VDouble) + (2.0 * s * series) * 1.4426950408889634;
+    }
+
+    /**
+     * @brief Calculate log2 of positive numbers, falling back to the scalar log2 for subnormal, infinite or NaN lanes.
+     */
+    inline VDouble log2(VDouble x) {
+        const VInt isIrregular = (x < minNormal) | (x > 1.7976931348623157e308) | (x != x);
+        if (!any(isIrregular)) {
+            return log2Normal(x);
+        }
+        VDouble result;
+        for (size_t i = 0; i < width; i++) {
+            result[i] = __builtin_log2(x[i]);
+        }
+        return result;
+    }
+
+    double dotKernel(const double *v1, const double *v2, size_t size) {
+        VDouble dot = {};
+        size_t i = 0;
+        for (; i + width <= size; i += width) {
+            dot += load(v1 + i) * load(v2 + i);
+        }
+        if (i < size) {
+            dot += loadPartial(v1 + i, size - i, 0.0) * loadPartial(v2 + i, size - i, 0.0);
+        }
+        return sum(dot);
+    }
+
+    anagraph::kernels::DotProducts dotAndNormsKernel(const double *v1, const double *v2, size_t size) {
+        VDouble dot = {};
+        VDouble norm1 = {};
+        VDouble norm2 = {};
+        auto accumulate = [&](VDouble x, VDouble y) {
+            dot += x * y;
+            norm1 += x * x;
+            norm2 += y * y;
+        };
+        size_t i = 0;
+        for (; i + width <= size; i += width) {
+            accumulate(load(v1 + i), load(v2 + i));
+        }
+        if (i < size) {
+            accumulate(loadPartial(v1 + i, size - i, 0.0), loadPartial(v2 + i, size - i, 0.0));
+        }
+        return anagraph::kernels::DotProducts{sum(dot), sum(norm1), sum(norm2)};
+    }
+
+    /**
+     * @return false if q contains 0.0 where p is non-zero
+     */
+    bool klKernel(const double *p, const double *q, size_t size, double &result) {
+        VDouble kl = {};
+        auto accumulate = [&](VDouble pv, VDouble qv) {
+            const VInt isPositive = pv != 0.0;
+            if (any(isPositive & (qv == 0.0))) {
+                return false;
+            }
+            const VDouble ratio = select(isPositive, pv / qv, broadcast(1.0));
+            kl += select(isPositive, pv * log2(ratio), VDouble{});
+            return true;
+        };
+        size_t i = 0;
+        for (; i + width <= size; i += width) {
+            if (!accumulate(load(p + i), load(q + i))) {
+                return false;
+            }
+        }
+        if (i < size && !accumulate(loadPartial(p + i, size - i, 0.0), loadPartial(q + i, size - i, 1.0))) {
+            return false;
+        }
+        result = sum(kl);
+        return true;
+    }
+
+    double jsKernel(const double *p, const double *q, size_t size) {
+        VDouble js = {};
+        auto accumulate = [&](VDouble pv, VDouble qv) {
+            const VDouble m = (pv + qv) * 0.5;
+            const VInt isPPositive = pv != 0.0;
+            const VInt isQPositive = qv != 0.0;
+            const VDouble pRatio = select(isPPositive, pv / m, broadcast(1.0));
+            const VDouble qRatio = select(isQPositive, qv / m, broadcast(1.0));
+            js += select(isPPositive, pv * log2(pRatio), VDouble{});
+            js += select(isQPositive, qv * log2(qRatio), VDouble{});
+        };
+        size_t i = 0;
+        for (; i + width <= size; i += width) {
+            accumulate(load(p + i), load(q + i));
+        }
+        if (i < size) {
+            accumulate(loadPartial(p + i, size - i, 0.0), loadPartial(q + i, size - i, 0.0));
+        }
+        return sum(js) / 2;
+    }
+
+    /**
+     * @brief Count the common elements of two sorted arrays, comparing a block of each array at once.
+     *
+     * Every element of the block of a is compared with every element of the block of b by broadcasting,
+     * and the block with the smaller last element is skipped, so that each pair of blocks is compared at most once.
+     */
+    size_t intersectionKernel(const int *a, size_t sizeA, const int *b, size_t sizeB) {
+        VIndex hits = {};
+        size_t i = 0;
+        size_t j = 0;
+        while (i + indexWidth <= sizeA && j + indexWidth <= sizeB) {
+            VIndex block;
+            __builtin_memcpy(&block, a + i, sizeof(block));
+            VIndex matches = {};
+            for (size_t k = 0; k < indexWidth; k++) {
+                matches |= block == (VIndex{} + b[j + k]);
+            }
+            hits -= matches; // matches is -1 where true
+            const int lastA = a[i + indexWidth - 1];
+            const int lastB = b[j + indexWidth - 1];
+            i += lastA <= lastB ? indexWidth : 0;
+            j += lastB <= lastA ? indexWidth : 0;
+        }
+
+        size_t count = 0;
+        for (size_t k = 0; k < indexWidth; k++) {
+            count += hits[k];
+        }
+        while (i < sizeA && j < sizeB) {
+            const int x = a[i];
+            const int y = b[j];
+            count += x == y;
+            i += x <= y;
+            j += y <= x;
+        }
+        return count;
+    }
+}
+
+#endif // VECTOR_KERNELS_SIMD_HPP
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "anagraph/components/compressed_graph.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    using namespace anagraph;
+
+    template <typename Func>
+    void forEachAdjacent(const std::unordered_map<int, double> &adjacents, Func func) {
+        for (const auto &[dst, weight] : adjacents) {
+            func(dst, weight);
+        }
+    }
+
+    template <typename Func>
+    void forEachAdjacent(const std::unordered_set<int> &adjacents, Func func) {
+        for (const int dst : adjacents) {
+            func(dst, 1.0);
+        }
+    }
+
+    int findIndex(const std::vector<int> &ids, int id) {
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it == ids.end() || *it != id) {
+            return -1;
+        }
+        return it - ids.begin();
+    }
+
+    /**
+     * @brief Fill the arrays of the compressed graph from a graph.
+     */
+    template <typename GraphType>
+    void compress(const GraphType &graph, std::vector<int> &ids, std::vector<size_t> &offsets, std::vector<int> &targets, std::vector<double> &weights) {
+        // the ids are visited in ascending order
+        const IdRange idRange = graph.getIdRange();
+        ids.assign(idRange.begin(), idRange.end());
+
+        // ids of a reorganized graph are 0 to n - 1, so the index is found without searching
+        const bool isContiguous = ids.empty() || static_cast<size_t>(ids.back()) - ids.front() + 1 == ids.size();
+        auto indexOf = [&](int id) {
+            if (!isContiguous) {
+                return findIndex(ids, id);
+            }
+            const int index = id - ids.front();
+            return (index < 0 || static_cast<size_t>(index) >= ids.size()) ? -1 : index;
+        };
+
+        offsets.assign(1, 0);
+        offsets.reserve(ids.size() + 1);
+        std::vector<std::pair<int, double>> row;
+        for (const int src : ids) {
+            row.clear();
+            forEachAdjacent(graph.getAdjacents(src), [&](int dst, double weight) {
+                const int index = indexOf(dst);
+                if (index == -1) {
+                    spdlog::debug("drop the edge {} -> {} to a missing node", src, dst);
+                    return;
+                }
+                row.emplace_back(index, weight);
+            });
+            std::sort(row.begin(), row.end());
+            for (const auto &[index, weight] : row) {
+                targets.push_back(index);
+                weights.push_back(weight);
+            }
+            offsets.push_back(targets.size());
+        }
+    }
+}
+
+namespace anagraph {
+namespace graph_structure {
+
+CompressedGraph::CompressedGraph(const WeightedDigraph &graph) {
+    compress(graph, ids, offsets, targets, weights);
+}
+
+CompressedGraph::CompressedGraph(const WeightedGraph &graph) {
+    compress(graph, ids, offsets, targets, weights);
+}
+
+CompressedGraph::CompressedGraph(const Digraph &graph) {
+    compress(graph, ids, offsets, targets, weights);
+}
+
+CompressedGraph::CompressedGraph(const Graph &graph) {
+    compress(graph, ids, offsets, targets, weights);
+}
+
+size_t CompressedGraph::size() const {
+    return ids.size();
+}
+
+size_t CompressedGraph::edgeSize() const {
+    return targets.size();
+}
+
+int CompressedGraph::getId(int index) const {
+    return ids[index];
+}
+
+int CompressedGraph::getIndex(int id) const {
+    const int index = findIndex(ids, id);
+    if (index == -1) {
+        throw std::out_of_range("Node does not exist");
+    }
+    return index;
+}
+
+std::span<const int> CompressedGraph::getIds() const {
+    return ids;
+}
+
+std::span<const size_t> CompressedGraph::getOffsets() const {
+    return offsets;
+}
+
+std::span<const int> CompressedGraph::getTargets() const {
+    return targets;
+}
+
+std::span<const double> CompressedGraph::getWeights() const {
+    return weights;
+}
+
+std::span<const int> CompressedGraph::getAdjacents(int index) const {
+    return std::span<const int>(targets).subspan(offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+std::span<const double> CompressedGraph::getWeights(int index) const {
+    return std::span<const double>(weights).subspan(offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+size_t CompressedGraph::getDegree(int index) const {
+    return offsets[index + 1] - offsets[index];
+}
+
+CompressedGraph CompressedGraph::transpose() const {
+    CompressedGraph transposed;
+    const size_t nodeSize = size();
+    transposed.ids = ids;
+    transposed.offsets.assign(nodeSize + 1, 0);
+    for (const int dst : targets) {
+        transposed.offsets[dst + 1]++;
+    }
+    for (size_t i = 0; i < nodeSize; i++) {
+        transposed.offsets[i + 1] += transposed.offsets[i];
+    }
+
+    // the sources are visited in ascending order, so each row stays sorted
+    transposed.targets.resize(targets.size());
+    transposed.weights.resize(weights.size());
+    std::vector<size_t> positions(transposed.offsets.begin(), transposed.offsets.end() - 1);
+    for (size_t src = 0; src < nodeSize; src++) {
+        for (size_t edge = offsets[src]; edge < offsets[src + 1]; edge++) {
+            const size_t position = positions[targets[edge]]++;
+            transposed.targets[position] = src;
+            transposed.weights[position] = weights[edge];
+        }
+    }
+    return transposed;
+}
+
+} // namespace graph_structure
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "anagraph/components/correction_set.hpp"
+
+#include "anagraph/components/graph_parser.hpp"
+#include "anagraph/components/graph_writer.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+namespace anagraph {
+namespace graph_structure {
+
+CorrectionSet::CorrectionSet() : isOrdered(false) {}
+
+CorrectionSet::CorrectionSet(bool isDirected) : isOrdered(isDirected) {}
+
+bool CorrectionSet::isDirected() const {
+    return isOrdered;
+}
+
+std::pair<int, int> CorrectionSet::normalize(int first, int second) const {
+    if (!isOrdered && second < first) {
+        return {second, first};
+    }
+    return {first, second};
+}
+
+void CorrectionSet::setSuperedge(int first, int second, double weight) {
+    superedges[normalize(first, second)] = weight;
+}
+
+bool CorrectionSet::hasSuperedge(int first, int second) const {
+    return superedges.contains(normalize(first, second));
+}
+
+double CorrectionSet::getSuperedgeWeight(int first, int second) const {
+    const auto it = superedges.find(normalize(first, second));
+    if (it == superedges.end()) {
+        throw std::out_of_range("Superedge does not exist");
+    }
+    return it->second;
+}
+
+void CorrectionSet::addAddition(int first, int second, int src, int dst, double weight) {
+    std::tie(src, dst) = normalize(src, dst);
+    std::vector<WeightedEdgeObject> &edges = additions[normalize(first, second)];
+    // the edges are usually added in ascending order, so the search is at the end
+    const auto it = std::lower_bound(edges.begin(), edges.end(), std::make_pair(src, dst), [](const WeightedEdgeObject &edge, const std::pair<int, int> &key) {
+        return std::tie(std::get<0>(edge), std::get<1>(edge)) < std::tie(key.first, key.second);
+    });
+    if (it != edges.end() && std::get<0>(*it) == src && std::get<1>(*it) == dst) {
+        std::get<2>(*it) = weight;
+        return;
+    }
+    edges.insert(it, WeightedEdgeObject(src, dst, weight));
+}
+
+void CorrectionSet::addRemoval(int first, int second, int src, int dst) {
+    const EdgeObject edge(normalize(src, dst));
+    std::vector<EdgeObject> &edges = removals[normalize(first, second)];
+    const auto it = std::lower_bound(edges.begin(), edges.end(), edge);
+    if (it == edges.end() || *it != edge) {
+        edges.insert(it, edge);
+    }
+}
+
+std::span<const WeightedEdgeObject> CorrectionSet::getAdditions(int first, int second) const {
+    const auto it = additions.find(normalize(first, second));
+    if (it == additions.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+std::span<const EdgeObject> CorrectionSet::getRemovals(int first, int second) const {
+    const auto it = removals.find(normalize(first, second));
+    if (it == removals.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+std::vector<std::pair<int, int>> CorrectionSet::getSupernodePairs() const {
+    std::vector<std::pair<int, int>> pairs;
+    pairs.reserve(superedges.size() + additions.size());
+    for (const auto &[pair, _] : superedges) {
+        pairs.push_back(pair);
+    }
+    for (const auto &[pair, _] : additions) {
+        pairs.push_back(pair);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    return pairs;
+}
+
+size_t CorrectionSet::getSuperedgeCount() const {
+    return superedges.size();
+}
+
+size_t CorrectionSet::getCorrectionCount() const {
+    size_t count = 0;
+    for (const auto &[_, edges] : additions) {
+        count += edges.size();
+    }
+    for (const auto &[_, edges] : removals) {
+        count += edges.size();
+    }
+    return count;
+}
+
+void CorrectionSet::readCorrections(std::string filePath, FileExtension extName, const HierarchyIndex &hierarchy) {
+    std::vector<WeightedEdgeObject> superedgeList;
+    std::vector<WeightedEdgeObject> additionList;
+    std::vector<EdgeObject> removalList;
+    switch (extName) {
+    case FileExtension::TXT: {
+        TextGraphParser parser;
+        superedgeList = parser.parseWeightedGraph(filePath + "/superedges.txt");
+        additionList = parser.parseWeightedGraph(filePath + "/additions.txt");
+        removalList = parser.parseGraph(filePath + "/removals.txt");
+    }
+        break;
+
+    case FileExtension::CSV: {
+        CSVGraphParser parser;
+        superedgeList = parser.parseWeightedGraph(filePath + "/superedges.csv");
+        additionList = parser.parseWeightedGraph(filePath + "/additions.csv");
+        removalList = parser.parseGraph(filePath + "/removals.csv");
+    }
+        break;
+
+    default:
+        throw std::invalid_argument("Invalid file extension");
+        break;
+    }
+
+    superedges.clear();
+    additions.clear();
+    removals.clear();
+    for (const auto &[first, second, weight] : superedgeList) {
+        setSuperedge(first, second, weight);
+    }
+    for (const auto &[src, dst, weight] : additionList) {
+        addAddition(hierarchy.getRoot(src), hierarchy.getRoot(dst), src, dst, weight);
+    }
+    for (const auto &[src, dst] : removalList) {
+        addRemoval(hierarchy.getRoot(src), hierarchy.getRoot(dst), src, dst);
+    }
+    spdlog::debug("read {} superedges and {} corrections", superedges.size(), getCorrectionCount());
+}
+
+void CorrectionSet::writeCorrections(std::string filePath, FileExtension extName) const {
+    std::vector<WeightedEdgeObject> superedgeList;
+    std::vector<WeightedEdgeObject> additionList;
+    std::vector<EdgeObject> removalList;
+    for (const auto &[pair, weight] : superedges) {
+        superedgeList.emplace_back(pair.first, pair.second, weight);
+    }
+    for (const auto &[_, edges] : additions) {
+        additionList.insert(additionList.end(), edges.begin(), edges.end());
+    }
+    for (const auto &[_, edges] : removals) {
+        removalList.insert(removalList.end(), edges.begin(), edges.end());
+    }
+
+    switch (extName) {
+    case FileExtension::TXT: {
+        TextGraphWriter writer;
+        writer.writeWeightedGraph(filePath + "/superedges.txt", superedgeList);
+        writer.writeWeightedGraph(filePath + "/additions.txt", additionList);
+        writer.writeGraph(filePath + "/removals.txt", removalList);
+    }
+        break;
+
+    case FileExtension::CSV: {
+        CSVGraphWriter writer;
+        writer.writeWeightedGraph(filePath + "/superedges.csv", superedgeList);
+        writer.writeWeightedGraph(filePath + "/additions.csv", additionList);
+        writer.writeGraph(filePath + "/removals.csv", removalList);
+    }
+        break;
+
+    default:
+        throw std::invalid_argument("Invalid file extension");
+        break;
+    }
+}
+
+} // namespace graph_structure
+} // namespace anagraph
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "anagraph/components/hierarchy_index.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    using namespace anagraph::graph_structure;
+
+    /**
+     * @brief Check if a node is a root, a node whose parent was removed is also regarded as a root.
+     */
+    bool isRootIn(const std::map<int, WeightedSupernode> &nodes, int id) {
+        const int parent = nodes.at(id).getParent();
+        return parent == WeightedSupernode::ROOT || !nodes.contains(parent);
+    }
+
+    int findRoot(const std::map<int, WeightedSupernode> &nodes, int id) {
+        while (!isRootIn(nodes, id)) {
+            id = nodes.at(id).getParent();
+        }
+        return id;
+    }
+}
+
+namespace anagraph {
+namespace graph_structure {
+
+HierarchyIndex::HierarchyIndex(const std::map<int, WeightedSupernode> &nodes) {
+    rebuild(nodes);
+}
+
+void HierarchyIndex::rebuild(const std::map<int, WeightedSupernode> &nodes) {
+    entries.clear();
+    leaves.clear();
+    nextPosition = 0;
+    entries.reserve(nodes.size());
+    for (const auto &[id, _] : nodes) {
+        if (isRootIn(nodes, id)) {
+            layout(nodes, id);
+        }
+    }
+    spdlog::debug("rebuilt the hierarchy index of {} nodes", entries.size());
+}
+
+void HierarchyIndex::update(const std::map<int, WeightedSupernode> &nodes, const std::vector<int> &changedNodes) {
+    // both the tree a node was laid out in and the tree it is in now have to be laid out again
+    std::vector<int> roots;
+    for (const int id : changedNodes) {
+        const auto it = entries.find(id);
+        if (it != entries.end()) {
+            roots.push_back(it->second.root);
+        }
+        if (nodes.contains(id)) {
+            roots.push_back(findRoot(nodes, id));
+        } else if (it != entries.end()) {
+            entries.erase(it);
+        }
+    }
+    std::sort(roots.begin(), roots.end());
+    roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+    for (const int root : roots) {
+        if (nodes.contains(root) && isRootIn(nodes, root)) {
+            layout(nodes, root);
+        }
+    }
+
+    // the old layouts of the changed trees are left in the arrays until compaction
+    if (leaves.size() > 2 * entries.size() + 64 || nextPosition > std::numeric_limits<int>::max() / 2) {
+        rebuild(nodes);
+    }
+}
+
+void HierarchyIndex::layout(const std::map<int, WeightedSupernode> &nodes, int root) {
+    struct Frame {
+        int id;
+        std::vector<int> children;
+        size_t next;
+    };
+    std::vector<Frame> stack;
+
+    auto enter = [&](int id, int parent) {
+        Entry &entry = entries[id];
+        entry.enter = nextPosition++;
+        entry.root = root;
+        entry.leafBegin = leaves.size();
+        entry.jumps.clear();
+        entry.depth = 0;
+        if (parent != WeightedSupernode::ROOT) {
+            entry.depth = entries.at(parent).depth + 1;
+            entry.jumps.push_back(parent);
+            // the 2^(k+1)-th ancestor is the 2^k-th ancestor of the 2^k-th ancestor
+            for (size_t k = 0; k < entry.jumps.size(); k++) {
+                const Entry &ancestor = entries.at(entry.jumps[k]);
+                if (ancestor.jumps.size() <= k) {
+                    break;
+                }
+                entry.jumps.push_back(ancestor.jumps[k]);
+            }
+        }
+
+        // the children are visited in ascending order, so that the layout is deterministic
+        std::vector<int> children;
+        for (const int child : nodes.at(id).getChildren()) {
+            if (nodes.contains(child) && nodes.at(child).getParent() == id) {
+                children.push_back(child);
+            }
+        }
+        std::sort(children.begin(), children.end());
+        if (children.empty()) {
+            leaves.push_back(id);
+        }
+        stack.push_back(Frame{id, std::move(children), 0});
+    };
+
+    enter(root, WeightedSupernode::ROOT);
+    while (!stack.empty()) {
+        Frame &frame = stack.back();
+        if (frame.next < frame.children.size()) {
+            const int child = frame.children[frame.next++];
+            enter(child, frame.id);
+            continue;
+        }
+        Entry &entry = entries.at(frame.id);
+        entry.exit = nextPosition;
+        entry.leafEnd = leaves.size();
+        stack.pop_back();
+    }
+}
+
+bool HierarchyIndex::contains(int id) const {
+    return entries.contains(id);
+}
+
+const HierarchyIndex::Entry& HierarchyIndex::getEntry(int id) const {
+    const auto it = entries.find(id);
+    if (it == entries.end()) {
+        throw std::out_of_range("Node does not exist");
+    }
+    return it->second;
+}
+
+bool HierarchyIndex::isAncestor(int ancestor, int descendant) const {
+    const Entry &ancestorEntry = getEntry(ancestor);
+    const Entry &descendantEntry = getEntry(descendant);
+    return ancestorEntry.enter <= descendantEntry.enter && descendantEntry.enter < ancestorEntry.exit;
+}
+
+std::span<const int> HierarchyIndex::getLeaves(int id) const {
+    const Entry &entry = getEntry(id);
+    return std::span<const int>(leaves).subspan(entry.leafBegin, entry.leafEnd - entry.leafBegin);
+}
+
+size_t HierarchyIndex::getLeafCount(int id) const {
+    const Entry &entry = getEntry(id);
+    return entry.leafEnd - entry.leafBegin;
+}
+
+int HierarchyIndex::getRoot(int id) const {
+    return getEntry(id).root;
+}
+
+int HierarchyIndex::getDepth(int id) const {
+    return getEntry(id).depth;
+}
+
+int HierarchyIndex::getLowestCommonAncestor(int first, int second) const {
+    const Entry *firstEntry = &getEntry(first);
+    const Entry *secondEntry = &getEntry(second);
+    if (firstEntry->root != secondEntry->root) {
+        return WeightedSupernode::ROOT;
+    }
+    if (firstEntry->depth < secondEntry->depth) {
+        std::swap(first, second);
+        std::swap(firstEntry, secondEntry);
+    }
+
+    // lift the deeper node to the same depth
+    for (int k = 0, diff = firstEntry->depth - secondEntry->depth; diff > 0; k++, diff >>= 1) {
+        if (diff & 1) {
+            first = firstEntry->jumps[k];
+            firstEntry = &entries.at(first);
+        }
+    }
+    if (first == second) {
+        return first;
+    }
+
+    // lift both nodes while their ancestors differ
+    for (int k = static_cast<int>(firstEntry->jumps.size()) - 1; k >= 0; k--) {
+        if (k < static_cast<int>(firstEntry->jumps.size()) && firstEntry->jumps[k] != secondEntry->jumps[k]) {
+            first = firstEntry->jumps[k];
+            second = secondEntry->jumps[k];
+            firstEntry = &entries.at(first);
+            secondEntry = &entries.at(second);
+        }
+    }
+    return firstEntry->jumps[0];
+}
+
+size_t HierarchyIndex::size() const {
+    return entries.size();
+}
+
+} // namespace graph_structure
+} // namespace anagraph
\ No newline at end of file
@@ -1,8 +1,16 @@
 #include "anagraph/components/unweighted_digraph.hpp"
 
+#include "anagraph/components/subgraph_view.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
 
 namespace anagraph {
 namespace graph_structure {
@@ -39,6 +47,10 @@ std::unordered_set<int> Digraph::getIds() const {
     return ids;
 }
 
+IdRange Digraph::getIdRange() const {
+    return IdRange(nodes);
+}
+
 void Digraph::setEdge(int src, int dst) {
     if (!nodes.contains(src)) {
         setNode(src);
@@ -61,63 +73,77 @@ const std::unordered_set<int>& Digraph::getAdjacents(int id) const {
     return nodes.at(id).getAdjacents();
 }
 
-Digraph Digraph::getSubgraph(std::unordered_set<int> indices) const {
-    Digraph subgraph;
-    subgraph.nodes = this->nodes;
-
-    // remove unnecessary edges
-    for (auto idx : indices) {
-        const auto &adjacents = getAdjacents(idx);
-        for (auto &adj : adjacents) {
-            if (!indices.contains(adj)) {
-                subgraph.removeEdge(idx, adj);
-            }
-        }
-    }
-
-    // remove unnecessary nodes
-    for (auto idx : getIds()) {
-        if (!indices.contains(idx)) {
-            subgraph.removeNode(idx);
-        }
-    }
-    return subgraph;
+Digraph Digraph::getSubgraph(const std::unordered_set<int> &indices) const {
+    return SubgraphView<Digraph>(*this, indices).materialize();
 }
 
 void Digraph::reorganize() {
     spdlog::debug("called reorganize");
 
-    // Create a map from old id to new id
-    spdlog::debug("create idMap and update usedNodes");
+    // Create a map from old id to new id, keeping the order of the ids
     std::unordered_map<int, int> idMap;
+    idMap.reserve(nodes.size());
     int newId = 0;
     for (auto &[oldId, _] : nodes) {
-        idMap[oldId] = newId;
-        // move the node to the new id, with the adjacency list is maintained
-        nodes[newId] = std::move(nodes[oldId]);
-        nodes[newId].setId(newId);
-        newId++;
+        idMap[oldId] = newId++;
     }
+    relabel(idMap);
+}
 
-    // Update the nodes and the adjacents
-    spdlog::debug("update nodes and adjacents");
-    for (auto id : getIds()) {
-        if (id > newId) { // remove the node if it is not used
-            nodes.erase(id);
-            continue;
-        }
+void Digraph::relabel(const std::unordered_map<int, int> &idMap) {
+    relabel(idMap, 1);
+}
+
+void Digraph::relabel(const std::unordered_map<int, int> &idMap, int numThreads) {
+    spdlog::debug("called relabel with {} threads", numThreads);
 
-        // set the adjacents
-        auto &node = nodes.at(id);
-        auto oldAdjacents = node.getAdjacents();
-        for (auto oldAdj : oldAdjacents) {
-            node.removeAdjacent(oldAdj);
+    // Sort the nodes by the new id, so that the relabeled nodes are allocated in that order
+    std::vector<std::tuple<int, int, const Node*>> order;
+    order.reserve(nodes.size());
+    for (auto &[oldId, node] : nodes) {
+        auto it = idMap.find(oldId);
+        if (it == idMap.end()) {
+            throw std::invalid_argument("idMap does not contain the node " + std::to_string(oldId));
         }
-        for (auto oldAdj : oldAdjacents) {
-            const int newAdj = idMap[oldAdj];
-            node.setAdjacentNode(nodes[newAdj]);
+        order.emplace_back(it->second, oldId, &node);
+    }
+    std::sort(order.begin(), order.end(), [](const auto &a, const auto &b) {
+        return std::get<0>(a) < std::get<0>(b);
+    });
+
+    // Create the relabeled nodes, and the map from old id to the relabeled node
+    std::map<int, Node> relabeledNodes;
+    std::unordered_map<int, Node*> relabeledOf;
+    relabeledOf.reserve(nodes.size());
+    std::vector<std::pair<const Node*, Node*>> rewrites;
+    rewrites.reserve(nodes.size());
+    for (auto [newId, oldId, node] : order) {
+        if (!relabeledNodes.empty() && relabeledNodes.rbegin()->first == newId) {
+            throw std::invalid_argument("idMap maps two nodes to " + std::to_string(newId));
         }
-    }
+        auto relabeled = relabeledNodes.emplace_hint(relabeledNodes.end(), newId, Node(newId));
+        relabeledOf[oldId] = &relabeled->second;
+        rewrites.emplace_back(node, &relabeled->second);
+    }
+
+    // Rewrite the adjacents, each node only touches its own adjacency list
+    spdlog::debug("rewrite adjacents");
+    parallel::parallelFor(0, rewrites.size(), numThreads, [&](size_t i) {
+        auto [oldNode, newNode] = rewrites[i];
+        for (const int oldAdj : oldNode->getAdjacents()) {
+            auto it = relabeledOf.find(oldAdj);
+            if (it == relabeledOf.end()) {
+                spdlog::debug("relabel: drop the edge to missing node {}", oldAdj);
+                continue;
+            }
+            newNode->setAdjacentNode(*it->second);
+        }
+    });
+    nodes = std::move(relabeledNodes);
+}
+
+EdgeRange<Node> Digraph::getEdges() const {
+    return EdgeRange<Node>(nodes, false);
 }
 
 size_t Digraph::size() const {
@@ -157,12 +183,8 @@ void Digraph::readGraphHelper(std::string filePath, IGraphParser &parser) {
  void Digraph::writeGraph(std::string filePath, FileExtension extName) const {
     // convert the graph to a list of edges
     // note : implement as function in weighted_graph.hpp if needed
-    std::vector<EdgeObject> edges;
-    for (auto &[src, node] : nodes) {
-        for (auto dst : node.getAdjacents()) {
-            edges.emplace_back(EdgeObject(src, dst));
-        }
-    }
+    const auto edgeRange = getEdges();
+    std::vector<EdgeObject> edges(edgeRange.begin(), edgeRange.end());
 
     switch (extName) {
     case FileExtension::TXT: {
@@ -1,8 +1,12 @@
 #include "anagraph/components/unweighted_graph.hpp"
 
+#include "anagraph/components/subgraph_view.hpp"
+
 #include <spdlog/spdlog.h>
 
 #include <set>
+#include <stdexcept>
+#include <vector>
 
 namespace anagraph {
 namespace graph_structure {
@@ -31,6 +35,10 @@ std::unordered_set<int> Graph::getIds() const {
     return digraph.getIds();
 }
 
+IdRange Graph::getIdRange() const {
+    return digraph.getIdRange();
+}
+
 void Graph::setEdge(int src, int dst) {
     digraph.setEdge(src, dst);
     digraph.setEdge(dst, src);
@@ -41,24 +49,41 @@ void Graph::removeEdge(int src, int dst) {
     digraph.removeEdge(dst, src);
 }
 
-const std::unordered_set<int> Graph::getAdjacents(int id) const {
+const std::unordered_set<int>& Graph::getAdjacents(int id) const {
     return digraph.getAdjacents(id);
 }
 
-Graph Graph::getSubgraph(std::unordered_set<int> indices) const {
-    Graph subgraph;
-    subgraph.digraph = digraph.getSubgraph(indices);
-    return subgraph;
+Graph Graph::getSubgraph(const std::unordered_set<int> &indices) const {
+    return SubgraphView<Graph>(*this, indices).materialize();
 }
 
 void Graph::reorganize() {
     digraph.reorganize();
 }
 
+void Graph::relabel(const std::unordered_map<int, int> &idMap) {
+    digraph.relabel(idMap);
+}
+
+void Graph::relabel(const std::unordered_map<int, int> &idMap, int numThreads) {
+    digraph.relabel(idMap, numThreads);
+}
+
 Digraph Graph::toDigraph() const {
     return digraph;
 }
 
+EdgeRange<Node> Graph::getEdges() const {
+    return digraph.getEdges();
+}
+
+EdgeRange<Node> Graph::getEdges(bool isDeduplicated) const {
+    if (isDeduplicated) {
+        return digraph.getEdges().deduplicated();
+    }
+    return digraph.getEdges();
+}
+
 size_t Graph::size() const {
     return digraph.size();
 }
@@ -66,7 +91,7 @@ size_t Graph::size() const {
 void Graph::readGraph(std::string filePath, FileExtension extName) {
     digraph.readGraph(filePath, extName);
     Digraph deepCopy = digraph;
-    for (auto id : digraph.getIds()) {
+    for (auto id : deepCopy.getIdRange()) {
         for (auto adj : deepCopy.getAdjacents(id)) {
             digraph.setEdge(adj, id);
         }
@@ -74,16 +99,27 @@ void Graph::readGraph(std::string filePath, FileExtension extName) {
 }
 
 void Graph::writeGraph(std::string filePath, FileExtension extName) const {
-    auto digraph = toDigraph();
-    for (auto id : digraph.getIds()) {
-        auto adjacents = digraph.getAdjacents(id);
-        for (auto adj : adjacents) {
-            if (id > adj) {
-                digraph.removeEdge(id, adj);
-            }
-        }
+    // each edge is written once as src <= dst
+    const auto edgeRange = getEdges(true);
+    std::vector<EdgeObject> edges(edgeRange.begin(), edgeRange.end());
+
+    switch (extName) {
+    case FileExtension::TXT: {
+        TextGraphWriter writer;
+        writer.writeGraph(filePath, edges);
+    }
+        break;
+
+    case FileExtension::CSV: {
+        CSVGraphWriter writer;
+        writer.writeGraph(filePath, edges);
+    }
+        break;
+
+    default:
+        throw std::invalid_argument("Invalid file extension");
+        break;
     }
-    digraph.writeGraph(filePath, extName);
 }
 
 } // namespace graph
@@ -47,6 +47,11 @@ std::unordered_set<int> HeteroDigraph<T>::getIds() const {
     return ids;
 }
 
+template <typename T>
+IdRange HeteroDigraph<T>::getIdRange() const {
+    return IdRange(nodes);
+}
+
 template <typename T>
 void HeteroDigraph<T>::setEdge(int src, int dst) {
     if (!nodes.contains(src)) {
@@ -87,7 +92,7 @@ HeteroDigraph<T> HeteroDigraph<T>::getSubgraph(std::unordered_set<int> indices)
     }
 
     // remove unnecessary nodes
-    for (int idx : getIds()) {
+    for (int idx : getIdRange()) {
         if (!indices.contains(idx)) {
             subgraph.removeNode(idx);
         }
@@ -35,6 +35,11 @@ std::unordered_set<int> HeteroGraph<T>::getIds() const {
     return digraph.getIds();
 }
 
+template <typename T>
+IdRange HeteroGraph<T>::getIdRange() const {
+    return digraph.getIdRange();
+}
+
 template <typename T>
 void HeteroGraph<T>::setEdge(int src, int dst) {
     digraph.setEdge(src, dst);
@@ -88,7 +93,7 @@ template <typename T>
 void HeteroGraph<T>::readGraph(std::string filename, FileExtension extName) {
     digraph.readGraph(filename, extName);
     HeteroDigraph<T> deepCopy = digraph;
-    for (int id : digraph.getIds()) {
+    for (int id : deepCopy.getIdRange()) {
         for (int adj : deepCopy.getAdjacents(id)) {
             digraph.setEdge(adj, id);
         }
@@ -98,7 +103,7 @@ void HeteroGraph<T>::readGraph(std::string filename, FileExtension extName) {
 template <typename T>
 void HeteroGraph<T>::writeGraph(std::string filename, FileExtension extName) const {
     HeteroDigraph<T> digraph = toDigraph();
-    for (int id : digraph.getIds()) {
+    for (int id : digraph.getIdRange()) {
         for (int adj : digraph.getAdjacents(id)) {
             if (id > adj) {
                 digraph.removeEdge(id, adj);
@@ -1,9 +1,16 @@
 #include "anagraph/components/weighted_digraph.hpp"
 
+#include "anagraph/components/subgraph_view.hpp"
+#include "anagraph/utils/parallel_utils.hpp"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <set>
 #include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
 
 namespace anagraph {
 namespace graph_structure {
@@ -38,6 +45,10 @@ std::unordered_set<int> WeightedDigraph::getIds() const {
     return ids;
 }
 
+IdRange WeightedDigraph::getIdRange() const {
+    return IdRange(nodes);
+}
+
 void WeightedDigraph::setEdge(int src, int dst, double weight) {
     if (!nodes.contains(src)) {
         setNode(src);
@@ -80,63 +91,77 @@ const std::unordered_map<int, double>& WeightedDigraph::getAdjacents(int id) con
     return nodes.at(id).getAdjacents();
 }
 
-WeightedDigraph WeightedDigraph::getSubgraph(std::unordered_set<int> indices) const {
-    WeightedDigraph subgraph;
-    // copy necessary nodes
-    for (auto idx : indices) {
-        if (!nodes.contains(idx)) {
-            throw std::out_of_range("Node does not exist");
-        }
-        WeightedNode node = nodes.at(idx);
-        subgraph.setNode(node);
-    }
-    
-    // remove unnecessary edges
-    for (auto idx : indices) {
-        const auto &adjacents = getAdjacents(idx);
-        for (auto [adj, weight] : adjacents) {
-            if (!indices.contains(adj)) {
-                subgraph.removeEdge(idx, adj);
-            }
-        }
-    }
-    return subgraph;
+WeightedDigraph WeightedDigraph::getSubgraph(const std::unordered_set<int> &indices) const {
+    return SubgraphView<WeightedDigraph>(*this, indices).materialize();
 }
 
 void WeightedDigraph::reorganize() {
     spdlog::debug("called reorganize");
 
-    // Create a map from old id to new id
-    spdlog::debug("create idMap and update usedNodes");
+    // Create a map from old id to new id, keeping the order of the ids
     std::unordered_map<int, int> idMap;
+    idMap.reserve(nodes.size());
     int newId = 0;
     for (auto &[oldId, _] : nodes) {
-        idMap[oldId] = newId;
-        // move the node to the new id, with the adjacency list is maintained
-        nodes[newId] = std::move(nodes[oldId]);
-        nodes[newId].setId(newId);
-        newId++;
-    }
-
-    // Update the nodes and the adjacents
-    spdlog::debug("update nodes and adjacents");
-    for (auto id : getIds()) {
-        if (id > newId) { // remove the node if it is not used
-            nodes.erase(id);
-            continue;
-        }
+        idMap[oldId] = newId++;
+    }
+    relabel(idMap);
+}
+
+void WeightedDigraph::relabel(const std::unordered_map<int, int> &idMap) {
+    relabel(idMap, 1);
+}
 
-        // set the adjacents
-        auto &node = nodes.at(id);
-        auto oldAdjacents = node.getAdjacents();
-        for (auto &[oldAdj, _] : oldAdjacents) {
-            node.removeAdjacent(oldAdj);
+void WeightedDigraph::relabel(const std::unordered_map<int, int> &idMap, int numThreads) {
+    spdlog::debug("called relabel with {} threads", numThreads);
+
+    // Sort the nodes by the new id, so that the relabeled nodes are allocated in that order
+    std::vector<std::tuple<int, int, const WeightedNode*>> order;
+    order.reserve(nodes.size());
+    for (auto &[oldId, node] : nodes) {
+        auto it = idMap.find(oldId);
+        if (it == idMap.end()) {
+            throw std::invalid_argument("idMap does not contain the node " + std::to_string(oldId));
         }
-        for (auto &[oldAdj, weight] : oldAdjacents) {
-            const int newAdj = idMap[oldAdj];
-            node.setAdjacentNode(nodes[newAdj], weight);
+        order.emplace_back(it->second, oldId, &node);
+    }
+    std::sort(order.begin(), order.end(), [](const auto &a, const auto &b) {
+        return std::get<0>(a) < std::get<0>(b);
+    });
+
+    // Create the relabeled nodes, and the map from old id to the relabeled node
+    std::map<int, WeightedNode> relabeledNodes;
+    std::unordered_map<int, WeightedNode*> relabeledOf;
+    relabeledOf.reserve(nodes.size());
+    std::vector<std::pair<const WeightedNode*, WeightedNode*>> rewrites;
+    rewrites.reserve(nodes.size());
+    for (auto [newId, oldId, node] : order) {
+        if (!relabeledNodes.empty() && relabeledNodes.rbegin()->first == newId) {
+            throw std::invalid_argument("idMap maps two nodes to " + std::to_string(newId));
         }
-    }
+        auto relabeled = relabeledNodes.emplace_hint(relabeledNodes.end(), newId, WeightedNode(newId));
+        relabeledOf[oldId] = &relabeled->second;
+        rewrites.emplace_back(node, &relabeled->second);
+    }
+
+    // Rewrite the adjacents, each node only touches its own adjacency list
+    spdlog::debug("rewrite adjacents");
+    parallel::parallelFor(0, rewrites.size(), numThreads, [&](size_t i) {
+        auto [oldNode, newNode] = rewrites[i];
+        for (const auto &[oldAdj, weight] : oldNode->getAdjacents()) {
+            auto it = relabeledOf.find(oldAdj);
+            if (it == relabeledOf.end()) {
+                spdlog::debug("relabel: drop the edge to missing node {}", oldAdj);
+                continue;
+            }
+            newNode->setAdjacentNode(*it->second, weight);
+        }
+    });
+    nodes = std::move(relabeledNodes);
+}
+
+EdgeRange<WeightedNode> WeightedDigraph::getEdges() const {
+    return EdgeRange<WeightedNode>(nodes, false);
 }
 
 size_t WeightedDigraph::size() const {
@@ -175,12 +200,8 @@ void WeightedDigraph::readGraphHelper(std::string filePath, IGraphParser &parser
 
 void WeightedDigraph::writeGraph(std::string filePath, FileExtension extName) const {
     // convert the graph to a list of edges
-    std::vector<WeightedEdgeObject> edges;
-    for (auto &[src, node] : nodes) {
-        for (auto &[dst, weight] : node.getAdjacents()) {
-            edges.push_back(WeightedEdgeObject(src, dst, weight));
-        }
-    }
+    const auto edgeRange = getEdges();
+    std::vector<WeightedEdgeObject> edges(edgeRange.begin(), edgeRange.end());
 
     switch (extName) {
     case FileExtension::TXT: {
@@ -1,8 +1,12 @@
 #include "anagraph/components/weighted_directed_supergraph.hpp"
 
+#include "anagraph/utils/union_find.hpp"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <stdexcept>
+#include <tuple>
 
 namespace anagraph {
 namespace graph_structure {
@@ -12,20 +16,34 @@ WeightedSuperDigraph::WeightedSuperDigraph(std::string filepath, FileExtension e
 }
 
 WeightedSupernode& WeightedSuperDigraph::getNode(int id) {
+    // the caller may change the hierarchy through the reference
+    isHierarchyStale = true;
     return nodes.at(id);
 }
 
 void WeightedSuperDigraph::setNode(int id) {
-    nodes.insert({id, WeightedSupernode(id)});
+    if (nodes.insert({id, WeightedSupernode(id)}).second) {
+        recordHierarchyChange(id);
+    }
 }
 
 void WeightedSuperDigraph::setNode(const WeightedSupernode &node) {
     const int nodeId = node.getId();
     nodes.insert({nodeId, node});
+    isHierarchyStale = true;
 }
 
 void WeightedSuperDigraph::removeNode(int id) {
-    nodes.erase(id);
+    const auto it = nodes.find(id);
+    if (it == nodes.end()) {
+        return;
+    }
+    // the children become roots of their own trees
+    recordHierarchyChange(id);
+    for (const int child : it->second.getChildren()) {
+        recordHierarchyChange(child);
+    }
+    nodes.erase(it);
 }
 
 void WeightedSuperDigraph::mergeNode(int first, int second, mergeLambda mergeFunc) {
@@ -53,6 +71,101 @@ void WeightedSuperDigraph::setMergeNodeFunction(mergeLambda mergeFunc) {
     mergeNodeFunc = mergeFunc;
 }
 
+std::unordered_map<int, int> WeightedSuperDigraph::mergeNodes(const std::vector<std::pair<int, int>> &pairs) {
+    for (const auto &[first, second] : pairs) {
+        if (!nodes.contains(first) || !nodes.contains(second)) {
+            throw std::out_of_range("Node does not exist");
+        }
+        if (!nodes.at(first).isRoot() || !nodes.at(second).isRoot()) {
+            throw std::invalid_argument("Node has already been merged");
+        }
+    }
+
+    // group the nodes of the pairs by union-find over their dense indices
+    std::unordered_map<int, int> indices;
+    std::vector<int> members;
+    auto indexOf = [&](int id) {
+        const auto [it, isInserted] = indices.try_emplace(id, members.size());
+        if (isInserted) {
+            members.push_back(id);
+        }
+        return it->second;
+    };
+    std::vector<std::pair<int, int>> indexPairs;
+    indexPairs.reserve(pairs.size());
+    for (const auto &[first, second] : pairs) {
+        const int firstIndex = indexOf(first);
+        indexPairs.emplace_back(firstIndex, indexOf(second));
+    }
+    UnionFind groups(members.size());
+    for (const auto &[first, second] : indexPairs) {
+        groups.unite(first, second);
+    }
+
+    // create a new supernode for each group of two or more nodes,
+    // numbered after the largest id of the graph since the global counter may lag behind it
+    std::unordered_map<int, int> merged;
+    std::vector<int> supernodes(members.size(), WeightedSupernode::UNUSED_ID);
+    int nextId = nodes.empty() ? 0 : nodes.rbegin()->first + 1;
+    size_t supernodeCount = 0;
+    for (size_t i = 0; i < members.size(); i++) {
+        const int group = groups.find(i);
+        if (groups.setSize(group) < 2) {
+            continue;
+        }
+        if (supernodes[group] == WeightedSupernode::UNUSED_ID) {
+            supernodes[group] = nextId++;
+            nodes.emplace(supernodes[group], WeightedSupernode(supernodes[group]));
+            recordHierarchyChange(supernodes[group]);
+            supernodeCount++;
+        }
+        merged.emplace(members[i], supernodes[group]);
+    }
+    spdlog::debug("merge {} nodes into {} supernodes", merged.size(), supernodeCount);
+
+    // redirect the edges between root nodes in a single pass, before the members get their parent
+    auto representative = [&](int id) {
+        const auto it = merged.find(id);
+        return it == merged.end() ? id : it->second;
+    };
+    std::vector<WeightedEdgeObject> redirected;
+    for (const auto &[src, node] : nodes) {
+        if (!node.isRoot()) {
+            continue;
+        }
+        const bool isSrcMerged = merged.contains(src);
+        for (const auto &[dst, weight] : node.getAdjacents()) {
+            const auto dstNode = nodes.find(dst);
+            if (dstNode == nodes.end() || !dstNode->second.isRoot()) {
+                continue;
+            }
+            if (isSrcMerged || merged.contains(dst)) {
+                redirected.emplace_back(representative(src), representative(dst), weight);
+            }
+        }
+    }
+
+    // sum the weights of the parallel edges
+    std::sort(redirected.begin(), redirected.end(), [](const WeightedEdgeObject &a, const WeightedEdgeObject &b) {
+        return std::tie(std::get<0>(a), std::get<1>(a)) < std::tie(std::get<0>(b), std::get<1>(b));
+    });
+    for (size_t begin = 0; begin < redirected.size();) {
+        const auto [src, dst, _] = redirected[begin];
+        double weight = 0.0;
+        size_t end = begin;
+        for (; end < redirected.size() && std::get<0>(redirected[end]) == src && std::get<1>(redirected[end]) == dst; end++) {
+            weight += std::get<2>(redirected[end]);
+        }
+        nodes.at(src).updateAdjacentNode(nodes.at(dst), weight);
+        begin = end;
+    }
+
+    for (const auto &[member, supernode] : merged) {
+        setParent(member, supernode);
+    }
+    return merged;
+}
+
 std::unordered_set<int> WeightedSuperDigraph::getIds() const {
     std::unordered_set<int> ids;
     for (auto &[id, _] : nodes) {
@@ -61,6 +174,10 @@ std::unordered_set<int> WeightedSuperDigraph::getIds() const {
     return ids;
 }
 
+IdRange WeightedSuperDigraph::getIdRange() const {
+    return IdRange(nodes);
+}
+
 void WeightedSuperDigraph::setEdge(int src, int dst, double weight) {
     if (!nodes.contains(src)) {
         setNode(src);
@@ -115,6 +232,7 @@ void WeightedSuperDigraph::setParent(int child, int parent) {
     }
     nodes[child].setParent(parent);
     nodes[parent].addChild(child);
+    recordHierarchyChange(child);
 }
 
 void WeightedSuperDigraph::updateParent(int child, int parent) {
@@ -124,7 +242,10 @@ void WeightedSuperDigraph::updateParent(int child, int parent) {
     const int oldParent = nodes[child].getParent();
     nodes[child].setParent(parent);
     nodes[parent].addChild(child);
-    nodes[oldParent].removeChild(child);
+    if (oldParent != WeightedSupernode::ROOT && oldParent != parent && nodes.contains(oldParent)) {
+        nodes[oldParent].removeChild(child);
+    }
+    recordHierarchyChange(child);
 }
 
 void WeightedSuperDigraph::removeParent(int child) {
@@ -141,6 +262,7 @@ void WeightedSuperDigraph::removeParent(int child) {
     }
     nodes[child].setParent(WeightedSupernode::ROOT);
     nodes[parent].removeChild(child);
+    recordHierarchyChange(child);
 }
 
 std::unordered_set<int> WeightedSuperDigraph::getChildren(int id) const {
@@ -150,10 +272,38 @@ std::unordered_set<int> WeightedSuperDigraph::getChildren(int id) const {
     return nodes.at(id).getChildren();
 }
 
+const HierarchyIndex& WeightedSuperDigraph::getHierarchyIndex() const {
+    const std::lock_guard<std::mutex> lock(hierarchyMutex.mutex);
+    if (isHierarchyStale) {
+        hierarchyIndex.rebuild(nodes);
+        isHierarchyStale = false;
+    } else if (!hierarchyChanges.empty()) {
+        hierarchyIndex.update(nodes, hierarchyChanges);
+    }
+    hierarchyChanges.clear();
+    return hierarchyIndex;
+}
+
+void WeightedSuperDigraph::recordHierarchyChange(int id) {
+    if (isHierarchyStale) {
+        return;
+    }
+    hierarchyChanges.push_back(id);
+    // a full rebuild is cheaper than laying out most of the trees one by one
+    if (hierarchyChanges.size() > nodes.size()) {
+        isHierarchyStale = true;
+        hierarchyChanges.clear();
+    }
+}
+
 const std::unordered_map<int, double>& WeightedSuperDigraph::getAdjacents(int id) const {
     return nodes.at(id).getAdjacents();
 }
 
+EdgeRange<WeightedSupernode> WeightedSuperDigraph::getEdges() const {
+    return EdgeRange<WeightedSupernode>(nodes, false);
+}
+
 size_t WeightedSuperDigraph::size() const {
     return nodes.size();
 }
@@ -193,6 +343,7 @@ void WeightedSuperDigraph::readEdgeHelper(std::string filePath, IGraphParser &pa
 
 void WeightedSuperDigraph::readHierarchyHelper(std::string filePath, IGraphParser &parser) {
     // read the hierarchical edges from the file
+    isHierarchyStale = true;
     for (auto &[parent, child] : parser.parseGraph(filePath)) {
         nodes[child].setParent(parent);
         nodes[parent].addChild(child);
@@ -200,12 +351,10 @@ void WeightedSuperDigraph::readHierarchyHelper(std::string filePath, IGraphParse
 }
 
 void WeightedSuperDigraph::writeGraph(std::string filePath, FileExtension extName) const {
-    std::vector<WeightedEdgeObject> normalEdges;
+    const auto edgeRange = getEdges();
+    std::vector<WeightedEdgeObject> normalEdges(edgeRange.begin(), edgeRange.end());
     std::vector<EdgeObject> hierarchicalEdges;
     for (auto &[src, node] : nodes) {
-        for (auto [dst, weight] : node.getAdjacents()) {
-            normalEdges.push_back(WeightedEdgeObject(src, dst, weight));
-        }
         if (!node.isRoot()) {
             hierarchicalEdges.push_back(EdgeObject(node.getParent(), src));
         }
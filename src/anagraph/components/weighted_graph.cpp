@@ -1,7 +1,12 @@
 #include "anagraph/components/weighted_graph.hpp"
 
+#include "anagraph/components/subgraph_view.hpp"
+
 #include <spdlog/spdlog.h>
 
+#include <stdexcept>
+#include <vector>
+
 namespace anagraph {
 namespace graph_structure {
 
@@ -29,6 +34,10 @@ std::unordered_set<int> WeightedGraph::getIds() const {
     return digraph.getIds();
 }
 
+IdRange WeightedGraph::getIdRange() const {
+    return digraph.getIdRange();
+}
+
 void WeightedGraph::setEdge(int src, int dst, double weight) {
     digraph.setEdge(src, dst, weight);
     digraph.setEdge(dst, src, weight);
@@ -57,16 +66,33 @@ const std::unordered_map<int, double>& WeightedGraph::getAdjacents(int id) const
     return digraph.getAdjacents(id);
 }
 
-WeightedGraph WeightedGraph::getSubgraph(std::unordered_set<int> indices) const {
-    WeightedGraph subgraph;
-    subgraph.digraph = digraph.getSubgraph(indices);
-    return subgraph;
+WeightedGraph WeightedGraph::getSubgraph(const std::unordered_set<int> &indices) const {
+    return SubgraphView<WeightedGraph>(*this, indices).materialize();
 }
 
 void WeightedGraph::reorganize() {
     digraph.reorganize();
 }
 
+void WeightedGraph::relabel(const std::unordered_map<int, int> &idMap) {
+    digraph.relabel(idMap);
+}
+
+void WeightedGraph::relabel(const std::unordered_map<int, int> &idMap, int numThreads) {
+    digraph.relabel(idMap, numThreads);
+}
+
+EdgeRange<WeightedNode> WeightedGraph::getEdges() const {
+    return digraph.getEdges();
+}
+
+EdgeRange<WeightedNode> WeightedGraph::getEdges(bool isDeduplicated) const {
+    if (isDeduplicated) {
+        return digraph.getEdges().deduplicated();
+    }
+    return digraph.getEdges();
+}
+
 size_t WeightedGraph::size() const {
     return digraph.size();
 }
@@ -78,7 +104,7 @@ WeightedDigraph WeightedGraph::toDigraph() const {
 void WeightedGraph::readGraph(std::string filePath, FileExtension extName) {
     digraph.readGraph(filePath, extName);
     WeightedDigraph deepCopy = digraph;
-    for (auto src : digraph.getIds()) {
+    for (auto src : deepCopy.getIdRange()) {
         for (auto [adj, weight] : deepCopy.getAdjacents(src)) {
             digraph.setEdge(adj, src, weight);
         }
@@ -86,17 +112,27 @@ void WeightedGraph::readGraph(std::string filePath, FileExtension extName) {
 }
 
 void WeightedGraph::writeGraph(std::string filePath, FileExtension extName) const {
-    auto digraph = toDigraph();
-    for (auto id : digraph.getIds()) {
-        auto adjacents = digraph.getAdjacents(id);
-        for (auto [adj, _] : adjacents) {
-            if (id > adj) {
-                digraph.removeEdge(id, adj);
-
-            }
-        }
+    // each edge is written once as src <= dst
+    const auto edgeRange = getEdges(true);
+    std::vector<WeightedEdgeObject> edges(edgeRange.begin(), edgeRange.end());
+
+    switch (extName) {
+    case FileExtension::TXT: {
+        TextGraphWriter writer;
+        writer.writeWeightedGraph(filePath, edges);
+    }
+        break;
+
+    case FileExtension::CSV: {
+        CSVGraphWriter writer;
+        writer.writeWeightedGraph(filePath, edges);
+    }
+        break;
+
+    default:
+        throw std::invalid_argument("Invalid file extension");
+        break;
     }
-    digraph.writeGraph(filePath, extName);
 }
 
 } // namespace graph
@@ -44,6 +44,11 @@ std::unordered_set<int> WeightedHeteroDigraph<T>::getIds() const {
     return ids;
 }
 
+template <typename T>
+IdRange WeightedHeteroDigraph<T>::getIdRange() const {
+    return IdRange(nodes);
+}
+
 template <typename T>
 void WeightedHeteroDigraph<T>::setEdge(int src, int dst, double weight) {
     if (!nodes.contains(src)) {
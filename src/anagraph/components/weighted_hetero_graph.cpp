@@ -35,6 +35,11 @@ std::unordered_set<int> WeightedHeteroGraph<T>::getIds() const {
     return digraph.getIds();
 }
 
+template <typename T>
+IdRange WeightedHeteroGraph<T>::getIdRange() const {
+    return digraph.getIdRange();
+}
+
 template <typename T>
 void WeightedHeteroGraph<T>::setEdge(int src, int dst, double weight) {
     digraph.setEdge(src, dst, weight);
@@ -105,7 +110,7 @@ template <typename T>
 void WeightedHeteroGraph<T>::readGraph(std::string filePath, FileExtension extName) {
     digraph.readGraph(filePath, extName);
     WeightedHeteroDigraph deepCopy = digraph;
-    for (auto id : digraph.getIds()) {
+    for (auto id : deepCopy.getIdRange()) {
         for (auto &[adj, weight] : deepCopy.getAdjacents(id)) {
             digraph.setEdge(adj, id, weight);
         }
@@ -115,7 +120,7 @@ void WeightedHeteroGraph<T>::readGraph(std::string filePath, FileExtension extNa
 template <typename T>
 void WeightedHeteroGraph<T>::writeGraph(std::string filePath, FileExtension extName) const {
     WeightedHeteroDigraph<T> digraph = toDigraph();
-    for (auto id : digraph.getIds()) {
+    for (auto id : digraph.getIdRange()) {
         auto adjacents = digraph.getAdjacents(id);
         for (auto [adj, _] : adjacents) {
             if (id > adj) {
@@ -29,6 +29,10 @@ std::unordered_set<int> WeightedSupergraph::getIds() const {
     return digraph.getIds();
 }
 
+IdRange WeightedSupergraph::getIdRange() const {
+    return digraph.getIdRange();
+}
+
 void WeightedSupergraph::setEdge(int src, int dst, double weight) {
     digraph.setEdge(src, dst, weight);
     digraph.setEdge(dst, src, weight);
@@ -51,6 +55,22 @@ void WeightedSupergraph::setMergeNodeFunction(mergeLambda mergeFunc) {
     digraph.setMergeNodeFunction(mergeFunc);
 }
 
+std::unordered_map<int, int> WeightedSupergraph::mergeNodes(const std::vector<std::pair<int, int>> &pairs) {
+    const std::unordered_map<int, int> merged = digraph.mergeNodes(pairs);
+
+    // an edge inside a group is redirected in both directions, so the self loop counts it twice
+    std::unordered_map<int, double> memberLoops;
+    for (const auto &[member, supernode] : merged) {
+        memberLoops[supernode] += digraph.getWeight(member, member);
+    }
+    for (const auto &[supernode, loopWeight] : memberLoops) {
+        if (digraph.getAdjacents(supernode).contains(supernode)) {
+            digraph.setWeight(supernode, supernode, (digraph.getWeight(supernode, supernode) + loopWeight) / 2);
+        }
+    }
+    return merged;
+}
+
 double WeightedSupergraph::getWeight(int src, int dst) const {
     return digraph.getWeight(src, dst);
 }
@@ -85,10 +105,25 @@ std::unordered_set<int> WeightedSupergraph::getChildren(int id) const {
     return digraph.getChildren(id);
 }
 
+const HierarchyIndex& WeightedSupergraph::getHierarchyIndex() const {
+    return digraph.getHierarchyIndex();
+}
+
 const std::unordered_map<int, double>& WeightedSupergraph::getAdjacents(int id) const {
     return digraph.getAdjacents(id);
 }
 
+EdgeRange<WeightedSupernode> WeightedSupergraph::getEdges() const {
+    return digraph.getEdges();
+}
+
+EdgeRange<WeightedSupernode> WeightedSupergraph::getEdges(bool isDeduplicated) const {
+    if (isDeduplicated) {
+        return digraph.getEdges().deduplicated();
+    }
+    return digraph.getEdges();
+}
+
 size_t WeightedSupergraph::size() const {
     return digraph.size();
 }
@@ -137,15 +172,11 @@ void WeightedSupergraph::readHierarchyHelper(std::string filePath, IGraphParser
     }
 }
 void WeightedSupergraph::writeGraph(std::string filePath, FileExtension extName) const {
-    std::vector<WeightedEdgeObject> normalEdges;
+    // each edge is written once as src <= dst
+    const auto edgeRange = getEdges(true);
+    std::vector<WeightedEdgeObject> normalEdges(edgeRange.begin(), edgeRange.end());
     std::vector<EdgeObject> hierarchicalEdges;
-    for (int src : digraph.getIds()) {
-        auto adjacents = digraph.getAdjacents(src);
-        for (auto [dst, weight] : adjacents) {
-            if (src <= dst) {
-                normalEdges.push_back(WeightedEdgeObject(src, dst, weight));
-            }
-        }
+    for (int src : digraph.getIdRange()) {
         if (digraph.getParent(src) != WeightedSupernode::ROOT) {
             hierarchicalEdges.push_back(EdgeObject(digraph.getParent(src), src));
         }
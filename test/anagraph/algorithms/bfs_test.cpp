@@ -0,0 +1,122 @@
+#include "anagraph/algorithms/bfs.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    /**
+     * @brief The distances by a plain queue, indexed as the result of the search.
+     */
+    std::vector<int> referenceDistances(const anagraph::graph_structure::CompressedGraph &graph, int source) {
+        std::vector<int> distances(graph.size(), anagraph::bfs::UNREACHED);
+        std::deque<int> queue = {graph.getIndex(source)};
+        distances[queue.front()] = 0;
+        while (!queue.empty()) {
+            const int current = queue.front();
+            queue.pop_front();
+            for (const int next : graph.getAdjacents(current)) {
+                if (distances[next] == anagraph::bfs::UNREACHED) {
+                    distances[next] = distances[current] + 1;
+                    queue.push_back(next);
+                }
+            }
+        }
+        return distances;
+    }
+
+    /**
+     * @brief Check that each parent is the smallest in-neighbor one level closer to the source.
+     */
+    void expectValidParents(const anagraph::graph_structure::CompressedGraph &transposed, const anagraph::bfs::BFSResult &result, int source) {
+        for (size_t i = 0; i < transposed.size(); i++) {
+            if (result.distances[i] == anagraph::bfs::UNREACHED) {
+                EXPECT_EQ(result.parents[i], anagraph::bfs::UNREACHED);
+                continue;
+            }
+            if (result.distances[i] == 0) {
+                EXPECT_EQ(result.parents[i], source);
+                continue;
+            }
+            const auto adjacents = transposed.getAdjacents(i);
+            const auto parent = std::find_if(adjacents.begin(), adjacents.end(), [&](int src) {
+                return result.distances[src] == result.distances[i] - 1;
+            });
+            ASSERT_NE(parent, adjacents.end());
+            EXPECT_EQ(result.parents[i], transposed.getId(*parent));
+        }
+    }
+
+    /**
+     * @brief A random digraph which is dense enough to be searched bottom-up.
+     */
+    anagraph::graph_structure::Digraph randomDigraph(int size, int degree) {
+        std::mt19937 engine(42);
+        std::uniform_int_distribution<int> distribution(0, size - 1);
+        anagraph::graph_structure::Digraph graph;
+        for (int src = 0; src < size; src++) {
+            graph.setNode(src);
+            for (int i = 0; i < degree; i++) {
+                graph.setEdge(src, distribution(engine));
+            }
+        }
+        return graph;
+    }
+}
+
+TEST(BFSTest, Karate) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    const graph_structure::Graph graph(datasetFile, FileExtension::TXT);
+    const graph_structure::CompressedGraph compressed(graph);
+
+    const bfs::BFSResult result = bfs::breadthFirstSearch(graph, 1);
+    EXPECT_EQ(result.distances, referenceDistances(compressed, 1));
+    expectValidParents(compressed, result, 1);
+
+    const bfs::BFSResult parallel = bfs::breadthFirstSearch(graph, 1, 4);
+    EXPECT_EQ(parallel.distances, result.distances);
+    EXPECT_EQ(parallel.parents, result.parents);
+
+    EXPECT_THROW(bfs::breadthFirstSearch(graph, 100), std::out_of_range);
+}
+
+TEST(BFSTest, Unreachable) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    graph_structure::Digraph graph;
+    graph.setEdge(0, 1);
+    graph.setEdge(1, 2);
+    graph.setEdge(3, 0);
+
+    const bfs::BFSResult result = bfs::breadthFirstSearch(graph, 0);
+    EXPECT_EQ(result.distances, std::vector<int>({0, 1, 2, bfs::UNREACHED}));
+    EXPECT_EQ(result.parents, std::vector<int>({0, 0, 1, bfs::UNREACHED}));
+}
+
+TEST(BFSTest, DirectionOptimizing) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    const graph_structure::Digraph graph = randomDigraph(5000, 16);
+    const graph_structure::CompressedGraph compressed(graph);
+    const graph_structure::CompressedGraph transposed = compressed.transpose();
+
+    const bfs::BFSResult result = bfs::breadthFirstSearch(compressed, transposed, 0, 1);
+    EXPECT_EQ(result.distances, referenceDistances(compressed, 0));
+    expectValidParents(transposed, result, 0);
+
+    const bfs::BFSResult parallel = bfs::breadthFirstSearch(compressed, transposed, 0, 4);
+    EXPECT_EQ(parallel.distances, result.distances);
+    EXPECT_EQ(parallel.parents, result.parents);
+
+    EXPECT_THROW(bfs::breadthFirstSearch(compressed, graph_structure::CompressedGraph(), 0, 1), std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "anagraph/algorithms/centrality.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    /**
+     * @brief Calculate the betweenness over the ordered pairs from the distances and the numbers of the shortest paths.
+     */
+    std::vector<double> naiveBetweenness(const anagraph::graph_structure::CompressedGraph &graph) {
+        const size_t size = graph.size();
+        const double infinity = std::numeric_limits<double>::infinity();
+        std::vector<std::vector<double>> distances(size, std::vector<double>(size, infinity));
+        std::vector<std::vector<double>> paths(size, std::vector<double>(size, 0.0));
+        for (size_t s = 0; s < size; s++) {
+            distances[s][s] = 0.0;
+            for (size_t round = 0; round < size; round++) {
+                for (size_t node = 0; node < size; node++) {
+                    const auto adjacents = graph.getAdjacents(node);
+                    const auto weights = graph.getWeights(node);
+                    for (size_t i = 0; i < adjacents.size(); i++) {
+                        distances[s][adjacents[i]] = std::min(distances[s][adjacents[i]], distances[s][node] + weights[i]);
+                    }
+                }
+            }
+            std::vector<int> order(size);
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](int a, int b) {
+                return distances[s][a] < distances[s][b];
+            });
+            paths[s][s] = 1.0;
+            for (const int node : order) {
+                const auto adjacents = graph.getAdjacents(node);
+                const auto weights = graph.getWeights(node);
+                for (size_t i = 0; i < adjacents.size(); i++) {
+                    if (distances[s][adjacents[i]] == distances[s][node] + weights[i]) {
+                        paths[s][adjacents[i]] += paths[s][node];
+                    }
+                }
+            }
+        }
+        std::vector<double> scores(size, 0.0);
+        for (size_t s = 0; s < size; s++) {
+            for (size_t t = 0; t < size; t++) {
+                for (size_t v = 0; v < size; v++) {
+                    if (s != t && s != v && t != v && distances[s][t] < infinity && distances[s][v] + distances[v][t] == distances[s][t]) {
+                        scores[v] += paths[s][v] * paths[v][t] / paths[s][t];
+                    }
+                }
+            }
+        }
+        return scores;
+    }
+
+    /**
+     * @brief Calculate the harmonic centrality and the closeness of each node by BFS from every node.
+     */
+    std::pair<std::vector<double>, std::vector<double>> naiveCloseness(const anagraph::graph_structure::CompressedGraph &graph) {
+        const size_t size = graph.size();
+        std::vector<double> harmonics(size, 0.0);
+        std::vector<double> closeness(size, 0.0);
+        for (size_t source = 0; source < size; source++) {
+            std::vector<int> distances(size, -1);
+            std::vector<int> queue = {static_cast<int>(source)};
+            distances[source] = 0;
+            double distanceSum = 0.0;
+            for (size_t head = 0; head < queue.size(); head++) {
+                const int node = queue[head];
+                for (const int adjacent : graph.getAdjacents(node)) {
+                    if (distances[adjacent] < 0) {
+                        distances[adjacent] = distances[node] + 1;
+                        harmonics[source] += 1.0 / distances[adjacent];
+                        distanceSum += distances[adjacent];
+                        queue.push_back(adjacent);
+                    }
+                }
+            }
+            closeness[source] = distanceSum > 0 ? (queue.size() - 1) / distanceSum : 0.0;
+        }
+        return {harmonics, closeness};
+    }
+}
+
+TEST(CentralityTest, Betweenness) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::Graph path;
+    for (int i = 0; i < 4; i++) {
+        path.setEdge(i, i + 1);
+    }
+    const std::vector<double> pathScores = centrality::betweenness(path);
+    ASSERT_EQ(pathScores.size(), 5u);
+    EXPECT_DOUBLE_EQ(pathScores[0], 0.0);
+    EXPECT_DOUBLE_EQ(pathScores[1], 3.0);
+    EXPECT_DOUBLE_EQ(pathScores[2], 4.0);
+    EXPECT_DOUBLE_EQ(pathScores[3], 3.0);
+    EXPECT_DOUBLE_EQ(pathScores[4], 0.0);
+
+    // the heavy edge 0-2 is bypassed by the 2 equal paths 0-1-2 and 0-3-2, and 1-3 passes 0
+    graph_structure::WeightedGraph weighted;
+    weighted.setEdge(0, 1, 1.0);
+    weighted.setEdge(1, 2, 1.0);
+    weighted.setEdge(0, 2, 5.0);
+    weighted.setEdge(0, 3, 0.5);
+    weighted.setEdge(3, 2, 1.5);
+    const std::vector<double> weightedScores = centrality::betweenness(weighted);
+    EXPECT_DOUBLE_EQ(weightedScores[0], 1.0);
+    EXPECT_DOUBLE_EQ(weightedScores[1], 0.5);
+    EXPECT_DOUBLE_EQ(weightedScores[2], 0.0);
+    EXPECT_DOUBLE_EQ(weightedScores[3], 0.5);
+
+    graph_structure::Digraph cycle;
+    for (int i = 0; i < 4; i++) {
+        cycle.setEdge(i, (i + 1) % 4);
+    }
+    for (const double score : centrality::betweenness(cycle, 4)) {
+        EXPECT_DOUBLE_EQ(score, 3.0);
+    }
+
+    graph_structure::WeightedDigraph negative;
+    negative.setEdge(0, 1, -1.0);
+    ASSERT_THROW(centrality::betweenness(negative), std::invalid_argument);
+}
+
+TEST(CentralityTest, BetweennessMatchesNaive) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 29);
+    std::uniform_int_distribution<int> weightDistribution(1, 3);
+    graph_structure::WeightedDigraph weighted;
+    graph_structure::Digraph unweighted;
+    for (int i = 0; i < 90; i++) {
+        const int src = nodeDistribution(engine);
+        const int dst = nodeDistribution(engine);
+        weighted.setEdge(src, dst, weightDistribution(engine));
+        unweighted.setEdge(src, dst);
+    }
+    for (const auto &compressed : {graph_structure::CompressedGraph(weighted), graph_structure::CompressedGraph(unweighted)}) {
+        const std::vector<double> expected = naiveBetweenness(compressed);
+        const std::vector<double> serial = centrality::betweenness(compressed, false, 1);
+        const std::vector<double> parallel = centrality::betweenness(compressed, false, 4);
+        for (size_t node = 0; node < expected.size(); node++) {
+            EXPECT_NEAR(serial[node], expected[node], 1e-9);
+            EXPECT_NEAR(parallel[node], expected[node], 1e-9);
+        }
+    }
+
+    const graph_structure::Graph karate(datasetFile, FileExtension::TXT);
+    const graph_structure::CompressedGraph compressed(karate);
+    const std::vector<double> expected = naiveBetweenness(compressed);
+    const std::vector<double> scores = centrality::betweenness(karate, 4);
+    for (size_t node = 0; node < expected.size(); node++) {
+        EXPECT_NEAR(scores[node], expected[node] / 2, 1e-9);
+    }
+    EXPECT_NEAR(scores[compressed.getIndex(0)], 231.0714285714286, 1e-9);
+}
+
+TEST(CentralityTest, EstimateBetweenness) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    // too few nodes to sample, so the betweenness is exact
+    const graph_structure::Graph karate(datasetFile, FileExtension::TXT);
+    EXPECT_EQ(centrality::estimateBetweenness(karate, 0.1, 0.1), centrality::betweenness(karate));
+
+    graph_structure::Graph grid;
+    const int width = 30;
+    for (int row = 0; row < width; row++) {
+        for (int column = 0; column < width; column++) {
+            if (row + 1 < width) {
+                grid.setEdge(row * width + column, (row + 1) * width + column);
+            }
+            if (column + 1 < width) {
+                grid.setEdge(row * width + column, row * width + column + 1);
+            }
+        }
+    }
+    const double epsilon = 0.1;
+    const double size = width * width;
+    const std::vector<double> exact = centrality::betweenness(grid, 4);
+    const std::vector<double> estimated = centrality::estimateBetweenness(grid, epsilon, 0.1, 4);
+    ASSERT_EQ(estimated.size(), exact.size());
+    for (size_t node = 0; node < exact.size(); node++) {
+        EXPECT_NEAR(estimated[node], exact[node], epsilon * size * (size - 2) / 2);
+    }
+    const std::vector<double> serial = centrality::estimateBetweenness(grid, epsilon, 0.1);
+    for (size_t node = 0; node < exact.size(); node++) {
+        EXPECT_NEAR(serial[node], estimated[node], 1e-6);
+    }
+
+    ASSERT_THROW(centrality::estimateBetweenness(grid, 0.0, 0.1), std::invalid_argument);
+    ASSERT_THROW(centrality::estimateBetweenness(grid, 0.1, 1.0), std::invalid_argument);
+}
+
+TEST(CentralityTest, HarmonicAndCloseness) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::Digraph path;
+    path.setEdge(0, 1);
+    path.setEdge(1, 2);
+    path.setNode(3);
+    const std::vector<double> pathHarmonics = centrality::harmonicCentrality(path);
+    const std::vector<double> pathCloseness = centrality::closenessCentrality(path, 4);
+    EXPECT_NEAR(pathHarmonics[0], 1.5, 0.05);
+    EXPECT_NEAR(pathHarmonics[1], 1.0, 0.05);
+    EXPECT_DOUBLE_EQ(pathHarmonics[2], 0.0);
+    EXPECT_DOUBLE_EQ(pathHarmonics[3], 0.0);
+    EXPECT_NEAR(pathCloseness[0], 2.0 / 3, 0.05);
+    EXPECT_NEAR(pathCloseness[1], 1.0, 0.05);
+    EXPECT_DOUBLE_EQ(pathCloseness[3], 0.0);
+
+    const graph_structure::Graph karate(datasetFile, FileExtension::TXT);
+    const graph_structure::CompressedGraph compressed(karate);
+    const auto [expectedHarmonics, expectedCloseness] = naiveCloseness(compressed);
+    const std::vector<double> harmonics = centrality::harmonicCentrality(compressed, 12, 4);
+    const std::vector<double> closeness = centrality::closenessCentrality(compressed, 12, 4);
+    for (size_t node = 0; node < compressed.size(); node++) {
+        EXPECT_NEAR(harmonics[node], expectedHarmonics[node], 0.05 * expectedHarmonics[node]);
+        EXPECT_NEAR(closeness[node], expectedCloseness[node], 0.05 * expectedCloseness[node]);
+    }
+    EXPECT_EQ(harmonics, centrality::harmonicCentrality(compressed, 12, 1));
+
+    ASSERT_THROW(centrality::harmonicCentrality(compressed, 3, 1), std::invalid_argument);
+    ASSERT_THROW(centrality::closenessCentrality(compressed, 17, 1), std::invalid_argument);
+}
+
+TEST(CentralityTest, HarmonicOnGrid) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    graph_structure::Graph grid;
+    const int width = 24;
+    for (int row = 0; row < width; row++) {
+        for (int column = 0; column < width; column++) {
+            if (row + 1 < width) {
+                grid.setEdge(row * width + column, (row + 1) * width + column);
+            }
+            if (column + 1 < width) {
+                grid.setEdge(row * width + column, row * width + column + 1);
+            }
+        }
+    }
+    const graph_structure::CompressedGraph compressed(grid);
+    const auto [expectedHarmonics, expectedCloseness] = naiveCloseness(compressed);
+    const std::vector<double> harmonics = centrality::harmonicCentrality(grid, 4);
+    const std::vector<double> closeness = centrality::closenessCentrality(grid, 4);
+    double harmonicError = 0.0;
+    double closenessError = 0.0;
+    for (size_t node = 0; node < compressed.size(); node++) {
+        harmonicError += std::abs(harmonics[node] - expectedHarmonics[node]) / expectedHarmonics[node];
+        closenessError += std::abs(closeness[node] - expectedCloseness[node]) / expectedCloseness[node];
+    }
+    EXPECT_LT(harmonicError / compressed.size(), 0.05);
+    EXPECT_LT(closenessError / compressed.size(), 0.05);
+}
\ No newline at end of file
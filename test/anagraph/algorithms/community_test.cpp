@@ -0,0 +1,178 @@
+#include "anagraph/algorithms/community.hpp"
+#include "anagraph/components/compressed_graph.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    /**
+     * @brief Label the nodes by their root supernodes, relabeled in the order of the first nodes.
+     */
+    std::vector<int> communitiesOf(const anagraph::graph_structure::WeightedGraph &graph, const anagraph::graph_structure::WeightedSupergraph &summary) {
+        std::vector<int> ids;
+        for (const int id : graph.getIdRange()) {
+            ids.push_back(id);
+        }
+        std::sort(ids.begin(), ids.end());
+        std::map<int, int> labels;
+        std::vector<int> communities;
+        for (const int id : ids) {
+            const int root = summary.getHierarchyIndex().getRoot(id);
+            communities.push_back(labels.try_emplace(root, labels.size()).first->second);
+        }
+        return communities;
+    }
+
+    /**
+     * @brief Check if the nodes of each community are connected within the community.
+     */
+    bool isConnected(const anagraph::graph_structure::WeightedGraph &graph, const std::vector<int> &communities) {
+        const anagraph::graph_structure::CompressedGraph compressed(graph);
+        std::vector<bool> isVisited(compressed.size(), false);
+        std::vector<bool> isCommunitySeen(compressed.size(), false);
+        for (size_t root = 0; root < compressed.size(); root++) {
+            if (isVisited[root]) {
+                continue;
+            }
+            if (isCommunitySeen[communities[root]]) {
+                return false;
+            }
+            isCommunitySeen[communities[root]] = true;
+            std::vector<int> stack = {static_cast<int>(root)};
+            isVisited[root] = true;
+            while (!stack.empty()) {
+                const int node = stack.back();
+                stack.pop_back();
+                for (const int adjacent : compressed.getAdjacents(node)) {
+                    if (!isVisited[adjacent] && communities[adjacent] == communities[node]) {
+                        isVisited[adjacent] = true;
+                        stack.push_back(adjacent);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+}
+
+TEST(CommunityTest, TwoCliques) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::WeightedGraph graph;
+    for (int offset : {0, 10}) {
+        for (int src = 0; src < 5; src++) {
+            for (int dst = src + 1; dst < 5; dst++) {
+                graph.setEdge(offset + src, offset + dst, 1.0);
+            }
+        }
+    }
+    graph.setEdge(4, 10, 1.0);
+    graph.setNode(20);
+
+    const std::vector<int> expected = {0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2};
+    for (const auto &summary : {community::louvain(graph), community::leiden(graph)}) {
+        EXPECT_EQ(communitiesOf(graph, summary), expected);
+        // the leaves keep the edges, and a community is the parent of its nodes
+        EXPECT_DOUBLE_EQ(summary.getWeight(4, 10), 1.0);
+        EXPECT_EQ(summary.getChildren(summary.getParent(0)).size(), 5u);
+        EXPECT_EQ(summary.getParent(20), graph_structure::WeightedSupernode::ROOT);
+    }
+    EXPECT_NEAR(community::modularity(graph, expected), 20.0 / 21 - 2 * (21.0 / 42) * (21.0 / 42), 1e-12);
+
+    ASSERT_THROW(community::louvain(graph, 0.0, 1), std::invalid_argument);
+    ASSERT_THROW(community::modularity(graph, {0, 1}), std::invalid_argument);
+    graph.setEdge(0, 20, -1.0);
+    ASSERT_THROW(community::leiden(graph), std::invalid_argument);
+}
+
+TEST(CommunityTest, Karate) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    const graph_structure::WeightedGraph graph(datasetFile, FileExtension::TXT);
+
+    const std::vector<int> louvain = communitiesOf(graph, community::louvain(graph));
+    const std::vector<int> leiden = communitiesOf(graph, community::leiden(graph));
+    EXPECT_GT(community::modularity(graph, louvain), 0.40);
+    EXPECT_GT(community::modularity(graph, leiden), 0.41);
+    EXPECT_TRUE(isConnected(graph, leiden));
+    EXPECT_EQ(communitiesOf(graph, community::leiden(graph, 1.0, 4)), leiden);
+
+    // a higher resolution gives more communities
+    const std::vector<int> fine = communitiesOf(graph, community::leiden(graph, 3.0, 2));
+    EXPECT_GT(*std::max_element(fine.begin(), fine.end()), *std::max_element(leiden.begin(), leiden.end()));
+}
+
+TEST(CommunityTest, PlantedPartition) {
+    using namespace anagraph;
+    // 8 groups of 50 nodes, each node has about 10 edges inside its group and 1 edge outside
+    std::mt19937 engine(17);
+    std::uniform_int_distribution<int> member(0, 49);
+    std::uniform_int_distribution<int> group(0, 7);
+    graph_structure::WeightedGraph graph;
+    for (int g = 0; g < 8; g++) {
+        for (int i = 0; i < 250; i++) {
+            graph.setEdge(g * 50 + member(engine), g * 50 + member(engine), 1.0);
+        }
+    }
+    for (int i = 0; i < 200; i++) {
+        graph.setEdge(group(engine) * 50 + member(engine), group(engine) * 50 + member(engine), 1.0);
+    }
+
+    std::vector<int> planted;
+    for (int i = 0; i < 400; i++) {
+        planted.push_back(i / 50);
+    }
+    for (int numThreads : {1, 3}) {
+        const std::vector<int> louvain = communitiesOf(graph, community::louvain(graph, 1.0, numThreads));
+        const std::vector<int> leiden = communitiesOf(graph, community::leiden(graph, 1.0, numThreads));
+        EXPECT_EQ(louvain, planted);
+        EXPECT_EQ(leiden, planted);
+        EXPECT_TRUE(isConnected(graph, leiden));
+    }
+}
+
+TEST(CommunityTest, LabelPropagation) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    // 8 groups of 50 nodes with few edges between them
+    std::mt19937 engine(23);
+    std::uniform_int_distribution<int> member(0, 49);
+    std::uniform_int_distribution<int> group(0, 7);
+    graph_structure::WeightedGraph graph;
+    for (int g = 0; g < 8; g++) {
+        for (int i = 0; i < 300; i++) {
+            graph.setEdge(g * 50 + member(engine), g * 50 + member(engine), 1.0);
+        }
+    }
+    for (int i = 0; i < 40; i++) {
+        graph.setEdge(group(engine) * 50 + member(engine), group(engine) * 50 + member(engine), 1.0);
+    }
+    std::vector<int> planted;
+    for (int i = 0; i < 400; i++) {
+        planted.push_back(i / 50);
+    }
+
+    const graph_structure::WeightedSupergraph summary = community::labelPropagation(graph);
+    const std::vector<int> communities = communitiesOf(graph, summary);
+    EXPECT_GT(community::modularity(graph, communities), 0.7);
+    EXPECT_EQ(summary.getHierarchyIndex().getDepth(0), 1);
+    // the seeded mode does not depend on the number of threads
+    EXPECT_EQ(communitiesOf(graph, community::labelPropagation(graph, 0.001, 4, 3141592653)), communities);
+    EXPECT_EQ(communitiesOf(graph, community::labelPropagation(graph, 0.0, 3, 7)), planted);
+
+    const std::vector<int> async = communitiesOf(graph, community::labelPropagation(graph, 0.0, 4));
+    EXPECT_GT(community::modularity(graph, async), 0.7);
+
+    ASSERT_THROW(community::labelPropagation(graph, 1.5, 1), std::invalid_argument);
+    spdlog::set_level(spdlog::level::info);
+}
\ No newline at end of file
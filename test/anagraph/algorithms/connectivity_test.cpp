@@ -0,0 +1,91 @@
+#include "anagraph/algorithms/connectivity.hpp"
+#include "anagraph/utils/union_find.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+}
+
+TEST(ConnectivityTest, WeaklyConnected) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::Digraph graph;
+    graph.setEdge(5, 1);
+    graph.setEdge(1, 2);
+    graph.setEdge(3, 2);
+    graph.setEdge(7, 8);
+    graph.setNode(6);
+
+    const std::vector<int> expected = {1, 1, 1, 1, 6, 7, 7};
+    EXPECT_EQ(connectivity::weaklyConnectedComponents(graph), expected);
+    EXPECT_EQ(connectivity::weaklyConnectedComponents(graph, 4), expected);
+
+    const graph_structure::Graph karate(datasetFile, FileExtension::TXT);
+    const std::vector<int> labels = connectivity::weaklyConnectedComponents(karate);
+    EXPECT_EQ(labels, std::vector<int>(karate.size(), labels[0]));
+}
+
+TEST(ConnectivityTest, Afforest) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    // a large component of a random graph, and many pairs
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(0, 9999);
+    graph_structure::Graph graph;
+    for (int i = 0; i < 40000; i++) {
+        graph.setEdge(distribution(engine), distribution(engine));
+    }
+    for (int i = 0; i < 100; i++) {
+        graph.setEdge(20000 + 2 * i, 20001 + 2 * i);
+    }
+    const graph_structure::CompressedGraph compressed(graph);
+
+    const std::vector<int> labels = connectivity::weaklyConnectedComponents(compressed, true, 1);
+    // the same labels as the sequential union-find
+    UnionFind groups(compressed.size());
+    for (size_t src = 0; src < compressed.size(); src++) {
+        for (const int dst : compressed.getAdjacents(src)) {
+            groups.unite(src, dst);
+        }
+    }
+    for (size_t i = 0; i < compressed.size(); i++) {
+        for (const size_t j : {static_cast<size_t>(groups.find(i)), static_cast<size_t>(0)}) {
+            EXPECT_EQ(labels[i] == labels[j], groups.find(i) == groups.find(j));
+        }
+    }
+    EXPECT_EQ(connectivity::weaklyConnectedComponents(compressed, true, 4), labels);
+    EXPECT_EQ(connectivity::weaklyConnectedComponents(compressed, false, 4), labels);
+}
+
+TEST(ConnectivityTest, StronglyConnected) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::WeightedDigraph graph;
+    // the cycle 1 -> 2 -> 3 -> 1 reaches the cycle 4 <-> 5, and 6 is reached from both
+    graph.setEdge(1, 2, 1.0);
+    graph.setEdge(2, 3, 1.0);
+    graph.setEdge(3, 1, 1.0);
+    graph.setEdge(3, 4, 1.0);
+    graph.setEdge(4, 5, 1.0);
+    graph.setEdge(5, 4, 1.0);
+    graph.setEdge(5, 6, 1.0);
+    graph.setEdge(2, 6, 1.0);
+
+    EXPECT_EQ(connectivity::stronglyConnectedComponents(graph), std::vector<int>({1, 1, 1, 4, 4, 6}));
+
+    // a long path does not overflow the stack
+    graph_structure::Digraph path;
+    for (int i = 0; i < 100000; i++) {
+        path.setEdge(i, i + 1);
+    }
+    path.setEdge(100000, 0);
+    const std::vector<int> labels = connectivity::stronglyConnectedComponents(path);
+    EXPECT_EQ(labels, std::vector<int>(path.size(), 0));
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "anagraph/algorithms/core_decomposition.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    /**
+     * @brief Calculate the core numbers by removing the nodes of degree less than k for every k.
+     */
+    std::vector<int> naiveCoreNumbers(const anagraph::graph_structure::CompressedGraph &graph) {
+        std::vector<int> cores(graph.size(), 0);
+        std::vector<bool> isRemoved(graph.size(), false);
+        for (int k = 1; std::find(isRemoved.begin(), isRemoved.end(), false) != isRemoved.end(); k++) {
+            for (bool isChanged = true; isChanged;) {
+                isChanged = false;
+                for (size_t node = 0; node < graph.size(); node++) {
+                    if (isRemoved[node]) {
+                        continue;
+                    }
+                    int degree = 0;
+                    for (const int adjacent : graph.getAdjacents(node)) {
+                        degree += !isRemoved[adjacent] && adjacent != static_cast<int>(node);
+                    }
+                    if (degree < k) {
+                        isRemoved[node] = true;
+                        isChanged = true;
+                    }
+                }
+            }
+            for (size_t node = 0; node < graph.size(); node++) {
+                if (!isRemoved[node]) {
+                    cores[node] = k;
+                }
+            }
+        }
+        return cores;
+    }
+}
+
+TEST(CoreDecompositionTest, Graph) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    // a clique of 4 nodes with a tail, and an isolated node
+    graph_structure::Graph graph;
+    for (int src = 1; src <= 4; src++) {
+        for (int dst = src + 1; dst <= 4; dst++) {
+            graph.setEdge(src, dst);
+        }
+    }
+    graph.setEdge(4, 5);
+    graph.setEdge(5, 6);
+    graph.setEdge(6, 6);
+    graph.setNode(7);
+
+    const std::vector<int> expected = {3, 3, 3, 3, 1, 1, 0};
+    EXPECT_EQ(core_decomposition::coreNumbers(graph), expected);
+    EXPECT_EQ(core_decomposition::coreNumbers(graph, 4), expected);
+
+    const auto core = core_decomposition::kCore(graph, 2);
+    EXPECT_EQ(core.getIds(), std::vector<int>({1, 2, 3, 4}));
+    EXPECT_EQ(core.materialize().getAdjacents(4).size(), 3u);
+    EXPECT_EQ(core_decomposition::kCore(graph, 4).size(), 0u);
+}
+
+TEST(CoreDecompositionTest, Digraph) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    // a cycle of 3 nodes in both directions counts each pair once
+    graph_structure::Digraph graph;
+    graph.setEdge(1, 2);
+    graph.setEdge(2, 1);
+    graph.setEdge(2, 3);
+    graph.setEdge(3, 1);
+    graph.setEdge(4, 3);
+
+    const std::vector<int> expected = {2, 2, 2, 1};
+    EXPECT_EQ(core_decomposition::coreNumbers(graph), expected);
+    EXPECT_EQ(core_decomposition::coreNumbers(graph, 3), expected);
+    EXPECT_EQ(core_decomposition::kCore(graph, 2).getIds(), std::vector<int>({1, 2, 3}));
+
+    const graph_structure::CompressedGraph compressed(graph);
+    ASSERT_THROW(core_decomposition::coreNumbers(compressed, graph_structure::CompressedGraph()), std::invalid_argument);
+}
+
+TEST(CoreDecompositionTest, Random) {
+    using namespace anagraph;
+    const graph_structure::Graph karate(datasetFile, FileExtension::TXT);
+    const graph_structure::CompressedGraph compressedKarate(karate);
+    const std::vector<int> karateCores = core_decomposition::coreNumbers(karate);
+    EXPECT_EQ(karateCores, naiveCoreNumbers(compressedKarate));
+    EXPECT_EQ(*std::max_element(karateCores.begin(), karateCores.end()), 4);
+
+    // a dense part and a sparse part, to have many levels
+    std::mt19937 engine(3);
+    graph_structure::Graph graph;
+    std::uniform_int_distribution<int> dense(0, 99);
+    std::uniform_int_distribution<int> sparse(0, 1999);
+    for (int i = 0; i < 2000; i++) {
+        graph.setEdge(dense(engine), dense(engine));
+        graph.setEdge(sparse(engine), sparse(engine));
+    }
+    const graph_structure::CompressedGraph compressed(graph);
+    const std::vector<int> expected = naiveCoreNumbers(compressed);
+    EXPECT_EQ(core_decomposition::coreNumbers(compressed, compressed), expected);
+    for (int numThreads : {1, 2, 8}) {
+        EXPECT_EQ(core_decomposition::coreNumbers(compressed, compressed, numThreads), expected);
+    }
+}
\ No newline at end of file
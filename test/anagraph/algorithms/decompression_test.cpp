@@ -0,0 +1,129 @@
+#include "anagraph/algorithms/decompression.hpp"
+#include "anagraph/algorithms/summarization.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    std::vector<anagraph::WeightedEdgeObject> decompressAll(const anagraph::graph_structure::WeightedSupergraph &summary, const anagraph::graph_structure::CorrectionSet &corrections) {
+        std::vector<anagraph::WeightedEdgeObject> edges;
+        anagraph::decompression::decompress(summary, corrections, [&](int src, int dst, double weight) {
+            edges.emplace_back(src, dst, weight);
+        });
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    }
+
+    template <typename RangeType>
+    std::vector<anagraph::WeightedEdgeObject> sortedEdges(const RangeType &range) {
+        std::vector<anagraph::WeightedEdgeObject> edges(range.begin(), range.end());
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    }
+}
+
+TEST(DecompressionTest, RoundTrip) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    graph_structure::WeightedGraph graph(datasetFile, FileExtension::TXT);
+    graph.setEdge(1, 1, 2.0);
+    graph.setWeight(1, 2, 3.0);
+    const graph_structure::WeightedSupergraph summary = summarization::summarize(graph);
+
+    const graph_structure::CorrectionSet corrections = decompression::encode(summary);
+    EXPECT_FALSE(corrections.isDirected());
+    EXPECT_EQ(decompressAll(summary, corrections), sortedEdges(graph.getEdges(true)));
+}
+
+TEST(DecompressionTest, Cliques) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    // two cliques of 4 nodes joined by all but one edge
+    graph_structure::WeightedSupergraph summary;
+    for (int i = 1; i <= 8; i++) {
+        for (int j = i + 1; j <= 8; j++) {
+            if ((i <= 4) == (j <= 4) || !(i == 1 && j == 5)) {
+                summary.setEdge(i, j, 1.0);
+            }
+        }
+    }
+    const std::vector<WeightedEdgeObject> original = sortedEdges(summary.getEdges(true));
+    const auto merged = summary.mergeNodes({{1, 2}, {2, 3}, {3, 4}, {5, 6}, {6, 7}, {7, 8}});
+    const int first = std::min(merged.at(1), merged.at(5));
+    const int second = std::max(merged.at(1), merged.at(5));
+
+    const graph_structure::CorrectionSet corrections = decompression::encode(summary);
+    EXPECT_EQ(corrections.getSuperedgeCount(), static_cast<size_t>(3));
+    EXPECT_EQ(corrections.getCorrectionCount(), static_cast<size_t>(1));
+    ASSERT_EQ(corrections.getRemovals(first, second).size(), static_cast<size_t>(1));
+    EXPECT_EQ(corrections.getRemovals(second, first)[0], EdgeObject(1, 5));
+    EXPECT_EQ(decompressAll(summary, corrections), original);
+
+    // a single pair of supernodes
+    size_t count = 0;
+    decompression::decompress(summary, corrections, second, first, [&](int src, int dst, double weight) {
+        EXPECT_LT(src, dst);
+        EXPECT_DOUBLE_EQ(weight, 1.0);
+        count++;
+    });
+    EXPECT_EQ(count, static_cast<size_t>(15));
+    EXPECT_THROW(decompression::decompress(summary, corrections, 1, first, [](int, int, double) {}), std::invalid_argument);
+    EXPECT_THROW(decompression::decompress(summary, corrections, 100, first, [](int, int, double) {}), std::out_of_range);
+}
+
+TEST(DecompressionTest, Directed) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    graph_structure::WeightedSuperDigraph summary;
+    summary.setEdge(1, 3, 1.0);
+    summary.setEdge(1, 4, 1.0);
+    summary.setEdge(2, 3, 1.0);
+    summary.setEdge(2, 4, 2.0);
+    summary.setEdge(3, 1, 1.0);
+    summary.setEdge(1, 2, 1.0);
+    const std::vector<WeightedEdgeObject> original = sortedEdges(summary.getEdges());
+    const auto merged = summary.mergeNodes({{1, 2}, {3, 4}});
+
+    const graph_structure::CorrectionSet corrections = decompression::encode(summary);
+    EXPECT_TRUE(corrections.isDirected());
+    EXPECT_TRUE(corrections.hasSuperedge(merged.at(1), merged.at(3)));
+    EXPECT_FALSE(corrections.hasSuperedge(merged.at(3), merged.at(1)));
+
+    std::vector<WeightedEdgeObject> edges;
+    decompression::decompress(summary, corrections, [&](int src, int dst, double weight) {
+        edges.emplace_back(src, dst, weight);
+    });
+    std::sort(edges.begin(), edges.end());
+    EXPECT_EQ(edges, original);
+
+    const graph_structure::WeightedSupergraph undirected;
+    EXPECT_THROW(decompression::decompress(undirected, corrections, [](int, int, double) {}), std::invalid_argument);
+}
+
+TEST(DecompressionTest, WriteAndRead) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    graph_structure::WeightedGraph graph(datasetFile, FileExtension::TXT);
+    const graph_structure::WeightedSupergraph summary = summarization::summarize(graph);
+    const graph_structure::CorrectionSet corrections = decompression::encode(summary);
+
+    const std::filesystem::path outputDir = std::filesystem::temp_directory_path() / "anagraph_correction_set_test";
+    std::filesystem::create_directories(outputDir);
+    corrections.writeCorrections(outputDir.string(), FileExtension::TXT);
+    graph_structure::CorrectionSet restored;
+    restored.readCorrections(outputDir.string(), FileExtension::TXT, summary.getHierarchyIndex());
+    std::filesystem::remove_all(outputDir);
+
+    EXPECT_EQ(restored.getSuperedgeCount(), corrections.getSuperedgeCount());
+    EXPECT_EQ(restored.getCorrectionCount(), corrections.getCorrectionCount());
+    EXPECT_EQ(decompressAll(summary, restored), sortedEdges(graph.getEdges(true)));
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "anagraph/algorithms/local_clustering.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    /**
+     * @brief Calculate the conductance of a set of nodes from scratch.
+     */
+    double conductanceOf(const anagraph::graph_structure::Graph &graph, const std::vector<int> &ids) {
+        double volume = 0.0;
+        double totalVolume = 0.0;
+        double cut = 0.0;
+        for (const int id : graph.getIdRange()) {
+            totalVolume += graph.getAdjacents(id).size();
+        }
+        for (const int id : ids) {
+            volume += graph.getAdjacents(id).size();
+            for (const int adjacent : graph.getAdjacents(id)) {
+                cut += std::binary_search(ids.begin(), ids.end(), adjacent) ? 0.0 : 1.0;
+            }
+        }
+        return cut / std::min(volume, totalVolume - volume);
+    }
+}
+
+TEST(LocalClusteringTest, TwoCliques) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::WeightedGraph graph;
+    for (int offset : {0, 10}) {
+        for (int src = 0; src < 5; src++) {
+            for (int dst = src + 1; dst < 5; dst++) {
+                graph.setEdge(offset + src, offset + dst, 2.0);
+            }
+        }
+    }
+    graph.setEdge(4, 10, 2.0);
+    graph.setNode(20);
+
+    const local_clustering::LocalCluster cluster = local_clustering::findCluster(graph, 0);
+    EXPECT_EQ(cluster.ids, std::vector<int>({0, 1, 2, 3, 4}));
+    EXPECT_DOUBLE_EQ(cluster.volume, 42.0);
+    EXPECT_DOUBLE_EQ(cluster.cut, 2.0);
+    EXPECT_DOUBLE_EQ(cluster.conductance, 2.0 / 42);
+    EXPECT_EQ(local_clustering::findCluster(graph, 12, 0.15, 1e-4, 84.0).ids, std::vector<int>({10, 11, 12, 13, 14}));
+
+    const local_clustering::LocalCluster isolated = local_clustering::findCluster(graph, 20);
+    EXPECT_EQ(isolated.ids, std::vector<int>({20}));
+    EXPECT_DOUBLE_EQ(isolated.conductance, 1.0);
+
+    ASSERT_THROW(local_clustering::findCluster(graph, 30), std::out_of_range);
+    ASSERT_THROW(local_clustering::findCluster(graph, 0, 0.0, 1e-4), std::invalid_argument);
+    ASSERT_THROW(local_clustering::findCluster(graph, 0, 0.15, 0.0), std::invalid_argument);
+}
+
+TEST(LocalClusteringTest, Karate) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    const graph_structure::Graph graph(datasetFile, FileExtension::TXT);
+    for (const int seed : {0, 33}) {
+        const local_clustering::LocalCluster cluster = local_clustering::findCluster(graph, seed, 0.1, 1e-5);
+        EXPECT_TRUE(std::binary_search(cluster.ids.begin(), cluster.ids.end(), seed));
+        EXPECT_LT(cluster.conductance, 0.2);
+        EXPECT_NEAR(cluster.conductance, conductanceOf(graph, cluster.ids), 1e-12);
+        // the volume of the whole graph computed on demand gives the same cluster as the given one
+        EXPECT_EQ(local_clustering::findCluster(graph, seed, 0.1, 1e-5, 156.0).ids, cluster.ids);
+    }
+}
\ No newline at end of file
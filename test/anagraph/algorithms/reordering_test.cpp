@@ -0,0 +1,99 @@
+#include "anagraph/algorithms/reordering.hpp"
+
+#include "anagraph/algorithms/pagerank.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_set>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    // check that idMap maps the ids of the graph onto 0..size-1
+    void expectPermutation(const std::unordered_map<int, int> &idMap, size_t size) {
+        EXPECT_EQ(idMap.size(), size);
+        std::unordered_set<int> newIds;
+        for (const auto &[_, newId] : idMap) {
+            EXPECT_GE(newId, 0);
+            EXPECT_LT(newId, static_cast<int>(size));
+            newIds.insert(newId);
+        }
+        EXPECT_EQ(newIds.size(), size);
+    }
+}
+
+TEST(ReorderingTest, DegreeOrder) {
+    using namespace anagraph;
+    graph_structure::Graph graph;
+    graph.setEdge(10, 3);
+    graph.setEdge(10, 5);
+    graph.setEdge(10, 7);
+    graph.setEdge(3, 5);
+
+    auto idMap = reordering::degreeOrder(graph);
+    expectPermutation(idMap, graph.size());
+    EXPECT_EQ(idMap.at(10), 0);
+    EXPECT_EQ(idMap.at(3), 1);
+    EXPECT_EQ(idMap.at(5), 2);
+    EXPECT_EQ(idMap.at(7), 3);
+}
+
+TEST(ReorderingTest, ReverseCuthillMcKee) {
+    using namespace anagraph;
+    // a path graph with scattered ids
+    const std::vector<int> path = {7, 2, 9, 0, 5, 3, 8, 1, 6, 4};
+    graph_structure::Digraph graph;
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        graph.setEdge(path[i], path[i + 1]);
+    }
+
+    auto idMap = reordering::reverseCuthillMcKee(graph);
+    expectPermutation(idMap, graph.size());
+    // the bandwidth of a path is 1 after the reordering
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        EXPECT_EQ(std::abs(idMap.at(path[i]) - idMap.at(path[i + 1])), 1);
+    }
+}
+
+TEST(ReorderingTest, CommunityOrder) {
+    using namespace anagraph;
+    // two cliques {0, 2, 4, 6} and {1, 3, 5, 7} connected by a single edge
+    graph_structure::WeightedGraph graph;
+    for (int i = 0; i < 8; i += 2) {
+        for (int j = i + 2; j < 8; j += 2) {
+            graph.setEdge(i, j, 1.0);
+            graph.setEdge(i + 1, j + 1, 1.0);
+        }
+    }
+    graph.setEdge(0, 1, 1.0);
+
+    auto idMap = reordering::communityOrder(graph);
+    expectPermutation(idMap, graph.size());
+    // each clique gets a contiguous range of ids
+    std::vector<int> evenIds = {idMap.at(0), idMap.at(2), idMap.at(4), idMap.at(6)};
+    std::vector<int> oddIds = {idMap.at(1), idMap.at(3), idMap.at(5), idMap.at(7)};
+    EXPECT_EQ(*std::max_element(evenIds.begin(), evenIds.end()) - *std::min_element(evenIds.begin(), evenIds.end()), 3);
+    EXPECT_EQ(*std::max_element(oddIds.begin(), oddIds.end()) - *std::min_element(oddIds.begin(), oddIds.end()), 3);
+}
+
+TEST(ReorderingTest, RelabelKeepsPageRank) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph digraph(datasetFile, FileExtension::TXT);
+    const int size = digraph.size();
+    std::vector<double> source(size, 1.0);
+    auto [expected, _] = pagerank::forwardPush(digraph, source, 0.15, 1e-7);
+
+    for (const auto &idMap : {reordering::degreeOrder(digraph), reordering::reverseCuthillMcKee(digraph), reordering::communityOrder(digraph)}) {
+        expectPermutation(idMap, digraph.size());
+        graph_structure::WeightedDigraph reordered = digraph;
+        reordered.relabel(idMap);
+        auto [actual, _] = pagerank::forwardPush(reordered, source, 0.15, 1e-7);
+        for (const auto &[oldId, newId] : idMap) {
+            EXPECT_NEAR(actual[newId], expected[oldId], 1e-5);
+        }
+    }
+}
\ No newline at end of file
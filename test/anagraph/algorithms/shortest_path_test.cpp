@@ -0,0 +1,92 @@
+#include "anagraph/algorithms/shortest_path.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    anagraph::graph_structure::WeightedDigraph randomDigraph(int size, int degree) {
+        std::mt19937 engine(42);
+        std::uniform_int_distribution<int> nodeDistribution(0, size - 1);
+        std::uniform_real_distribution<double> weightDistribution(0.0, 10.0);
+        anagraph::graph_structure::WeightedDigraph graph;
+        for (int src = 0; src < size; src++) {
+            graph.setNode(src);
+            for (int i = 0; i < degree; i++) {
+                graph.setEdge(src, nodeDistribution(engine), weightDistribution(engine));
+            }
+        }
+        return graph;
+    }
+
+    /**
+     * @brief Check that each parent is on a shortest path.
+     */
+    void expectValidParents(const anagraph::graph_structure::WeightedDigraph &graph, const anagraph::shortest_path::ShortestPathResult &result) {
+        for (int id = 0; id < static_cast<int>(graph.size()); id++) {
+            const int parent = result.parents[id];
+            if (parent == anagraph::shortest_path::UNREACHED) {
+                EXPECT_TRUE(std::isinf(result.distances[id]));
+            } else if (parent != id) {
+                EXPECT_DOUBLE_EQ(result.distances[parent] + graph.getWeight(parent, id), result.distances[id]);
+            }
+        }
+    }
+}
+
+TEST(ShortestPathTest, Small) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::WeightedDigraph graph;
+    graph.setEdge(0, 1, 4.0);
+    graph.setEdge(0, 2, 1.0);
+    graph.setEdge(2, 1, 2.0);
+    graph.setEdge(1, 3, 1.0);
+    graph.setEdge(3, 0, 1.0);
+    graph.setNode(4);
+
+    for (const auto &result : {shortest_path::dijkstra(graph, 0), shortest_path::deltaStepping(graph, 0), shortest_path::deltaStepping(graph, 0, 0.5, 2)}) {
+        EXPECT_EQ(result.distances, std::vector<double>({0.0, 3.0, 1.0, 4.0, INFINITY}));
+        EXPECT_EQ(result.parents, std::vector<int>({0, 2, 0, 1, shortest_path::UNREACHED}));
+    }
+
+    EXPECT_THROW(shortest_path::dijkstra(graph, 100), std::out_of_range);
+    EXPECT_THROW(shortest_path::deltaStepping(graph, 0, 0.0, 1), std::invalid_argument);
+    // only the non-empty buckets are stored, while the bucket of a distance must fit in size_t
+    EXPECT_EQ(shortest_path::deltaStepping(graph, 0, 1e-12, 2).distances, std::vector<double>({0.0, 3.0, 1.0, 4.0, INFINITY}));
+    EXPECT_THROW(shortest_path::deltaStepping(graph, 0, 1e-300, 1), std::invalid_argument);
+    graph.setEdge(4, 0, -1.0);
+    EXPECT_THROW(shortest_path::dijkstra(graph, 0), std::invalid_argument);
+    EXPECT_THROW(shortest_path::deltaStepping(graph, 0), std::invalid_argument);
+}
+
+TEST(ShortestPathTest, Karate) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    const graph_structure::WeightedGraph graph(datasetFile, FileExtension::TXT);
+    const auto expected = shortest_path::dijkstra(graph, 1);
+    EXPECT_EQ(shortest_path::deltaStepping(graph, 1).distances, expected.distances);
+    EXPECT_EQ(shortest_path::deltaStepping(graph, 1, 3.0, 4).distances, expected.distances);
+}
+
+TEST(ShortestPathTest, Random) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    const graph_structure::WeightedDigraph graph = randomDigraph(2000, 8);
+    const auto expected = shortest_path::dijkstra(graph, 0);
+    expectValidParents(graph, expected);
+
+    for (const double delta : {0.5, 2.0, 100.0}) {
+        const auto result = shortest_path::deltaStepping(graph, 0, delta, 4);
+        EXPECT_EQ(result.distances, expected.distances);
+        expectValidParents(graph, result);
+    }
+}
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include <gtest/gtest.h>
 #include <spdlog/spdlog.h>
 
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+
 TEST(SimilarityTest, CosineSimilarity) {
     using namespace anagraph;
     std::vector<double> v1 = {1.0, 2.0, 3.0};
@@ -22,6 +27,57 @@ TEST(SimilarityTest, NDCG) {
     ASSERT_NEAR(result, 1.0, 1e-9);
 }
 
+TEST(SimilarityTest, NDCGTies) {
+    using namespace anagraph;
+    // ties are broken by the smaller index in both rankings
+    std::vector<double> expected = {1.0, 1.0, 1.0, 0.0};
+    std::vector<double> answer = {2.0, 2.0, 2.0, 2.0};
+    ASSERT_NEAR(similarity::nDCG(expected, answer, 3), 1.0, 1e-9);
+    EXPECT_THROW(similarity::nDCG(expected, answer, 5), std::invalid_argument);
+    EXPECT_THROW(similarity::nDCG(expected, answer, 0), std::invalid_argument);
+}
+
+TEST(SimilarityTest, PrecisionAndRecallAtK) {
+    using namespace anagraph;
+    std::vector<double> expected = {0.5, 0.3, 0.2, 0.0, 0.0};
+    std::vector<double> answer = {0.4, 0.1, 0.0, 0.3, 0.2};
+    // top-2: expected {0, 1}, answer {0, 3}
+    ASSERT_NEAR(similarity::precisionAtK(expected, answer, 2), 0.5, 1e-9);
+    // top-3 of answer {0, 3, 4} contains 1 of the top-3 of expected {0, 1, 2}
+    ASSERT_NEAR(similarity::precisionAtK(expected, answer, 3), 1.0/3, 1e-9);
+    ASSERT_NEAR(similarity::precisionAtK(expected, expected, 3), 1.0, 1e-9);
+    // the elements above 0.25 are {0, 1}, and top-4 of answer {0, 3, 4, 1} contains both of them
+    ASSERT_NEAR(similarity::precisionAtK(expected, answer, 4, 0.25), 0.5, 1e-9);
+    ASSERT_NEAR(similarity::recallAtK(expected, answer, 4, 0.25), 1.0, 1e-9);
+    ASSERT_NEAR(similarity::recallAtK(expected, answer, 2, 0.25), 0.5, 1e-9);
+    ASSERT_NEAR(similarity::recallAtK(expected, answer, 2, 0.6), 0.0, 1e-9);
+    EXPECT_THROW(similarity::precisionAtK(expected, {1.0}, 1), std::invalid_argument);
+}
+
+TEST(SimilarityTest, KendallTau) {
+    using namespace anagraph;
+    std::vector<double> expected = {4.0, 3.0, 2.0, 1.0, 0.0};
+    std::vector<double> reversed = {0.0, 1.0, 2.0, 3.0, 4.0};
+    std::vector<double> swapped = {3.0, 4.0, 2.0, 1.0, 0.0};
+    ASSERT_NEAR(similarity::kendallTau(expected, expected, 5), 1.0, 1e-9);
+    ASSERT_NEAR(similarity::kendallTau(expected, reversed, 5), -1.0, 1e-9);
+    // one discordant pair out of 10
+    ASSERT_NEAR(similarity::kendallTau(expected, swapped, 5), 0.8, 1e-9);
+    // top-2 of both are {0, 1}, and the pair is discordant
+    ASSERT_NEAR(similarity::kendallTau(expected, swapped, 2), -1.0, 1e-9);
+}
+
+TEST(SimilarityTest, Spearman) {
+    using namespace anagraph;
+    std::vector<double> expected = {4.0, 3.0, 2.0, 1.0, 0.0};
+    std::vector<double> reversed = {0.0, 1.0, 2.0, 3.0, 4.0};
+    std::vector<double> swapped = {3.0, 4.0, 2.0, 1.0, 0.0};
+    ASSERT_NEAR(similarity::spearman(expected, expected, 5), 1.0, 1e-9);
+    ASSERT_NEAR(similarity::spearman(expected, reversed, 5), -1.0, 1e-9);
+    // 1 - 6 * 2 / (5 * 24)
+    ASSERT_NEAR(similarity::spearman(expected, swapped, 5), 0.9, 1e-9);
+}
+
 TEST(SimilarityTest, KLdivergence) {
     using namespace anagraph;
     std::vector<double> p = {0.1, 0.2, 0.7};
@@ -38,6 +94,63 @@ TEST(SimilarityTest, JSdivergence) {
     ASSERT_NEAR(result, 0.031596722287467766, 1e-9);
 }
 
+TEST(SimilarityTest, SimilarityMatrix) {
+    using namespace anagraph;
+    // 70 vectors span two tiles for any dimension
+    std::mt19937 engine(7);
+    std::uniform_real_distribution<double> distribution(0.01, 1.0);
+    std::vector<std::vector<double>> vectors(70, std::vector<double>(9));
+    for (auto &vector : vectors) {
+        for (double &value : vector) {
+            value = distribution(engine);
+        }
+    }
+
+    for (int numThreads : {1, 3}) {
+        const auto cosine = similarity::cosineSimilarityMatrix(vectors, numThreads);
+        const auto js = similarity::JSdivergenceMatrix(vectors, numThreads);
+        ASSERT_EQ(cosine.size(), vectors.size());
+        for (size_t i = 0; i < vectors.size(); i++) {
+            for (size_t j = 0; j < vectors.size(); j++) {
+                ASSERT_NEAR(cosine[i][j], similarity::cosineSimilarity(vectors[i], vectors[j]), 1e-12);
+                ASSERT_NEAR(js[i][j], similarity::JSdivergence(vectors[i], vectors[j]), 1e-12);
+            }
+        }
+    }
+
+    vectors[3].push_back(1.0);
+    ASSERT_THROW(similarity::cosineSimilarityMatrix(vectors), std::invalid_argument);
+}
+
+TEST(SimilarityTest, TopKSimilarity) {
+    using namespace anagraph;
+    const std::vector<std::vector<double>> vectors = {
+        {1.0, 0.0, 0.0},
+        {0.9, 0.1, 0.0},
+        {0.0, 1.0, 0.0},
+        {0.0, 0.9, 0.1},
+        {0.9, 0.1, 0.0},
+    };
+    const auto cosine = similarity::topKCosineSimilarity(vectors, 2);
+    ASSERT_EQ(cosine.size(), 5u);
+    // 1 and 4 are the same vector, so the tie is broken by the smaller index
+    ASSERT_EQ(cosine[0].size(), 2u);
+    ASSERT_EQ(cosine[0][0].first, 1);
+    ASSERT_EQ(cosine[0][1].first, 4);
+    ASSERT_NEAR(cosine[0][0].second, similarity::cosineSimilarity(vectors[0], vectors[1]), 1e-12);
+    ASSERT_EQ(cosine[1][0].first, 4);
+    ASSERT_EQ(cosine[1][1].first, 0);
+    ASSERT_EQ(cosine[2][0].first, 3);
+
+    const auto js = similarity::topKJSdivergence(vectors, 1, 2);
+    ASSERT_EQ(js[4][0].first, 1);
+    ASSERT_NEAR(js[4][0].second, 0.0, 1e-12);
+    ASSERT_EQ(js[3][0].first, 2);
+
+    ASSERT_THROW(similarity::topKCosineSimilarity(vectors, 0), std::invalid_argument);
+    ASSERT_THROW(similarity::topKCosineSimilarity(vectors, 5), std::invalid_argument);
+}
+
 TEST(SimilarityTest, DirectedAccuracy) {
     using namespace anagraph;
     graph_structure::Digraph expected;
@@ -78,6 +191,30 @@ TEST(SimilarityTest, UndirectedAccuracy) {
     ASSERT_DOUBLE_EQ(result, 5.0/6);
 }
 
+TEST(SimilarityTest, ConfusionMatrixIgnoresOutsideEdges) {
+    using namespace anagraph;
+    graph_structure::Digraph expected;
+    expected.setEdge(1, 2);
+    expected.setEdge(2, 3);
+    expected.setEdge(3, 1);
+    expected.setEdge(1, 1);
+
+    // self loops and edges to nodes which are not in expected are not counted
+    graph_structure::Digraph answer;
+    answer.setEdge(1, 2);
+    answer.setEdge(1, 3);
+    answer.setEdge(2, 2);
+    answer.setEdge(3, 4);
+
+    // tp/fp/fn/tn = 1/2/1/2
+    EXPECT_DOUBLE_EQ(similarity::accuracy(expected, answer), 3.0/6);
+    EXPECT_DOUBLE_EQ(similarity::precision(expected, answer), 1.0/3);
+    EXPECT_DOUBLE_EQ(similarity::recall(expected, answer), 1.0/2);
+
+    graph_structure::Digraph missing;
+    missing.setEdge(1, 2);
+    EXPECT_THROW(similarity::precision(expected, missing), std::out_of_range);
+}
 
 TEST(SimilarityTest, DirectedPrecision) {
     using namespace anagraph;
@@ -198,4 +335,60 @@ TEST(SimilarityTest, UndirectedFMeasure) {
     answer.removeEdge(2, 3);
     result = similarity::fMeasure(expected, answer);
     ASSERT_DOUBLE_EQ(result, 0.8);
-}
\ No newline at end of file
+}
+
+TEST(SimilarityTest, CompareWeightedDigraphs) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph expected;
+    expected.setEdge(1, 2, 1.0);
+    expected.setEdge(2, 3, 2.0);
+    expected.setEdge(3, 1, 0.5);
+
+    graph_structure::WeightedDigraph answer;
+    answer.setEdge(1, 2, 1.5);
+    answer.setEdge(3, 1, 0.5);
+    answer.setEdge(1, 3, 1.0);
+
+    similarity::GraphComparison result = similarity::compareGraphs(expected, answer);
+    EXPECT_EQ(result.truePositive, 2);
+    EXPECT_EQ(result.falsePositive, 1);
+    EXPECT_EQ(result.falseNegative, 1);
+    EXPECT_EQ(result.trueNegative, 2);
+    EXPECT_DOUBLE_EQ(result.accuracy, 4.0/6);
+    EXPECT_DOUBLE_EQ(result.precision, 2.0/3);
+    EXPECT_DOUBLE_EQ(result.recall, 2.0/3);
+    EXPECT_DOUBLE_EQ(result.fMeasure, 2.0/3);
+    // |1.0 - 1.5| + |2.0 - 0| + |0 - 1.0|
+    EXPECT_DOUBLE_EQ(result.l1Error, 3.5);
+    EXPECT_DOUBLE_EQ(result.l2Error, std::sqrt(0.25 + 4.0 + 1.0));
+}
+
+TEST(SimilarityTest, CompareGraphs) {
+    using namespace anagraph;
+    const std::string filePath = PROJECT_SOURCE_DIR + std::string("/dataset/zackary_karate.txt");
+    graph_structure::WeightedGraph expected(filePath, FileExtension::TXT);
+    graph_structure::WeightedGraph answer = expected;
+    answer.removeEdge(0, 1);
+    answer.setEdge(0, 9, 2.0);
+
+    similarity::GraphComparison result = similarity::compareGraphs(expected, answer);
+    const int64_t n = expected.size();
+    EXPECT_EQ(result.falsePositive, 1);
+    EXPECT_EQ(result.falseNegative, 1);
+    EXPECT_EQ(result.truePositive + result.falsePositive + result.falseNegative + result.trueNegative, n * (n - 1) / 2);
+    EXPECT_DOUBLE_EQ(result.l1Error, 3.0);
+
+    // the result does not depend on the number of threads
+    similarity::GraphComparison parallelResult = similarity::compareGraphs(expected, answer, 4);
+    EXPECT_EQ(parallelResult.truePositive, result.truePositive);
+    EXPECT_EQ(parallelResult.trueNegative, result.trueNegative);
+    EXPECT_DOUBLE_EQ(parallelResult.l1Error, result.l1Error);
+
+    // the undirected comparison agrees with the metrics of the unweighted graph
+    graph_structure::Graph unweightedExpected(filePath, FileExtension::TXT);
+    graph_structure::Graph unweightedAnswer = unweightedExpected;
+    unweightedAnswer.removeEdge(0, 1);
+    unweightedAnswer.setEdge(0, 9);
+    EXPECT_DOUBLE_EQ(similarity::precision(unweightedExpected, unweightedAnswer), result.precision);
+    EXPECT_DOUBLE_EQ(similarity::fMeasure(unweightedExpected, unweightedAnswer), result.fMeasure);
+}
@@ -0,0 +1,132 @@
+#include "anagraph/algorithms/summarization.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    int rootOf(const anagraph::graph_structure::WeightedSupergraph &summary, int id) {
+        while (summary.getParent(id) != anagraph::graph_structure::WeightedSupernode::ROOT) {
+            id = summary.getParent(id);
+        }
+        return id;
+    }
+
+    /**
+     * @brief Get the sets of the original nodes under each root supernode.
+     */
+    std::set<std::set<int>> partition(const anagraph::graph_structure::WeightedSupergraph &summary, const std::vector<int> &ids) {
+        std::map<int, std::set<int>> groups;
+        for (const int id : ids) {
+            groups[rootOf(summary, id)].insert(id);
+        }
+        std::set<std::set<int>> result;
+        for (const auto &[_, group] : groups) {
+            result.insert(group);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Two cliques of 5 nodes joined by an edge.
+     */
+    anagraph::graph_structure::Graph twoCliques() {
+        anagraph::graph_structure::Graph graph;
+        for (int offset : {0, 5}) {
+            for (int i = 0; i < 5; i++) {
+                for (int j = i + 1; j < 5; j++) {
+                    graph.setEdge(offset + i, offset + j);
+                }
+            }
+        }
+        graph.setEdge(4, 5);
+        return graph;
+    }
+}
+
+TEST(SummarizationTest, TwoCliques) {
+    using namespace anagraph;
+    const graph_structure::Graph graph = twoCliques();
+    const graph_structure::WeightedSupergraph summary = summarization::summarize(graph);
+
+    // the leaves keep the original edges
+    for (const auto &[src, dst] : graph.getEdges(true)) {
+        EXPECT_DOUBLE_EQ(summary.getWeight(src, dst), 1.0);
+        EXPECT_DOUBLE_EQ(summary.getWeight(dst, src), 1.0);
+    }
+
+    std::vector<int> ids(graph.getIdRange().begin(), graph.getIdRange().end());
+    const auto groups = partition(summary, ids);
+    EXPECT_LT(groups.size(), ids.size());
+    // the nodes of different cliques except the bridge are never merged
+    for (const auto &group : groups) {
+        bool hasFirst = false;
+        bool hasSecond = false;
+        for (const int id : group) {
+            hasFirst |= id < 4;
+            hasSecond |= id > 5;
+        }
+        EXPECT_FALSE(hasFirst && hasSecond);
+    }
+
+    // the edges between the root supernodes sum up to the number of the edges
+    std::set<int> roots;
+    for (const int id : ids) {
+        roots.insert(rootOf(summary, id));
+    }
+    double total = 0.0;
+    for (const int root : roots) {
+        for (const auto &[adjacent, weight] : summary.getAdjacents(root)) {
+            if (root < adjacent && roots.contains(adjacent)) {
+                total += weight;
+            } else if (root == adjacent) {
+                total += weight;
+            }
+        }
+    }
+    EXPECT_DOUBLE_EQ(total, 21.0);
+}
+
+TEST(SummarizationTest, Deterministic) {
+    using namespace anagraph;
+    graph_structure::Graph graph(datasetFile, FileExtension::TXT);
+    std::vector<int> ids(graph.getIdRange().begin(), graph.getIdRange().end());
+
+    const auto expected = partition(summarization::summarize(graph, 10), ids);
+    EXPECT_LT(expected.size(), ids.size());
+    EXPECT_EQ(partition(summarization::summarize(graph, 10), ids), expected);
+    EXPECT_EQ(partition(summarization::summarize(graph, 10, 3), ids), expected);
+}
+
+TEST(SummarizationTest, WeightedGraph) {
+    using namespace anagraph;
+    graph_structure::WeightedGraph graph;
+    graph.setEdge(1, 3, 2.0);
+    graph.setEdge(1, 4, 0.5);
+    graph.setEdge(2, 3, 1.0);
+    graph.setEdge(2, 4, 1.5);
+
+    // 1 and 2 have the same adjacent nodes, so do 3 and 4
+    const graph_structure::WeightedSupergraph summary = summarization::summarize(graph);
+    const int first = rootOf(summary, 1);
+    const int second = rootOf(summary, 3);
+    EXPECT_NE(first, 1);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(rootOf(summary, 2), first);
+    EXPECT_EQ(rootOf(summary, 4), second);
+    EXPECT_DOUBLE_EQ(summary.getWeight(first, second), 5.0);
+}
+
+TEST(SummarizationTest, NoIteration) {
+    using namespace anagraph;
+    const graph_structure::Graph graph = twoCliques();
+    EXPECT_EQ(summarization::summarize(graph, 0).size(), graph.size());
+    EXPECT_THROW(summarization::summarize(graph, -1), std::invalid_argument);
+}
\ No newline at end of file
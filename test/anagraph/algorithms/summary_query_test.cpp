@@ -0,0 +1,114 @@
+#include "anagraph/algorithms/summary_query.hpp"
+
+#include "anagraph/algorithms/pagerank.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /**
+     * @brief The complete bipartite graph between {1, 2} and {3, 4}, summarized into two supernodes.
+     */
+    anagraph::graph_structure::WeightedSupergraph bipartiteSummary() {
+        anagraph::graph_structure::WeightedSupergraph graph;
+        graph.setEdge(1, 3, 1.0);
+        graph.setEdge(1, 4, 1.0);
+        graph.setEdge(2, 3, 1.0);
+        graph.setEdge(2, 4, 1.0);
+        graph.mergeNodes({{1, 2}, {3, 4}});
+        return graph;
+    }
+}
+
+TEST(SummaryQueryTest, ForwardPush) {
+    using namespace anagraph;
+    const graph_structure::WeightedSupergraph graph = bipartiteSummary();
+    const int first = graph.getParent(1);
+    const int second = graph.getParent(3);
+
+    const double alpha = 0.15;
+    const auto ppr = summary_query::forwardPush(graph, {{1, 1.0}}, alpha, 1e-12);
+    // the walk alternates between the supernodes
+    const double cycle = 1 - (1 - alpha) * (1 - alpha);
+    EXPECT_NEAR(ppr.at(first), alpha / cycle, 1e-9);
+    EXPECT_NEAR(ppr.at(second), alpha * (1 - alpha) / cycle, 1e-9);
+
+    const auto leaves = summary_query::expand(graph, ppr, second);
+    EXPECT_EQ(leaves.size(), static_cast<size_t>(2));
+    EXPECT_NEAR(leaves.at(3), ppr.at(second) / 2, 1e-12);
+    EXPECT_NEAR(leaves.at(4), ppr.at(second) / 2, 1e-12);
+
+    EXPECT_THROW(summary_query::forwardPush(graph, {{1, 0.0}}, alpha, 1e-12), std::invalid_argument);
+    EXPECT_THROW(summary_query::forwardPush(graph, {{100, 1.0}}, alpha, 1e-12), std::out_of_range);
+}
+
+TEST(SummaryQueryTest, ForwardPushMatchesLeaves) {
+    using namespace anagraph;
+    // the clique {0, 1, 2, 3} is attached to 4 by one edge from each member, and 4 to 5,
+    // so a walk on the leaves moves between the supernodes exactly as a walk on the summary
+    graph_structure::WeightedGraph leaves;
+    graph_structure::WeightedSupergraph graph;
+    for (int i = 0; i < 4; i++) {
+        for (int j = i + 1; j < 4; j++) {
+            leaves.setEdge(i, j, 1.0);
+            graph.setEdge(i, j, 1.0);
+        }
+        leaves.setEdge(i, 4, 1.0);
+        graph.setEdge(i, 4, 1.0);
+    }
+    leaves.setEdge(4, 5, 1.0);
+    graph.setEdge(4, 5, 1.0);
+    const int clique = graph.mergeNodes({{0, 1}, {1, 2}, {2, 3}}).at(0);
+
+    const double alpha = 0.15;
+    std::vector<double> source(6, 0.0);
+    source[4] = 1.0;
+    const auto [expected, _] = pagerank::forwardPush(leaves, source, alpha, 1e-12);
+    const auto ppr = summary_query::forwardPush(graph, {{4, 1.0}}, alpha, 1e-12);
+    EXPECT_NEAR(ppr.at(clique), expected[0] + expected[1] + expected[2] + expected[3], 1e-9);
+    EXPECT_NEAR(ppr.at(4), expected[4], 1e-9);
+    EXPECT_NEAR(ppr.at(5), expected[5], 1e-9);
+}
+
+TEST(SummaryQueryTest, Neighbors) {
+    using namespace anagraph;
+    graph_structure::WeightedSupergraph graph = bipartiteSummary();
+    graph.setEdge(10, 1, 1.0);
+    const int second = graph.getParent(3);
+
+    const auto supernodes = summary_query::getSupernodeNeighbors(graph, 1);
+    ASSERT_EQ(supernodes.size(), static_cast<size_t>(1));
+    EXPECT_EQ(supernodes[0].first, second);
+    EXPECT_DOUBLE_EQ(supernodes[0].second, 1.0);
+
+    EXPECT_EQ(summary_query::getNeighbors(graph, 2, 0.5), std::vector<int>({3, 4}));
+    EXPECT_TRUE(summary_query::getNeighbors(graph, 2, 1.5).empty());
+    // 10 is added after the summary, and its edge to 1 is below the summary
+    EXPECT_TRUE(summary_query::getNeighbors(graph, 10, 0.0).empty());
+}
+
+TEST(SummaryQueryTest, DirectedDensity) {
+    using namespace anagraph;
+    graph_structure::WeightedSuperDigraph graph;
+    graph.setEdge(1, 2, 1.0);
+    graph.setEdge(2, 1, 1.0);
+    graph.setEdge(1, 3, 1.0);
+    graph.setEdge(3, 3, 2.0);
+    const int supernode = graph.mergeNodes({{1, 2}}).at(1);
+
+    const auto neighbors = summary_query::getSupernodeNeighbors(graph, 2);
+    ASSERT_EQ(neighbors.size(), static_cast<size_t>(2));
+    EXPECT_EQ(neighbors[0].first, 3);
+    EXPECT_DOUBLE_EQ(neighbors[0].second, 0.5);
+    EXPECT_EQ(neighbors[1].first, supernode);
+    EXPECT_DOUBLE_EQ(neighbors[1].second, 1.0);
+    EXPECT_EQ(summary_query::getNeighbors(graph, 1, 0.6), std::vector<int>({2}));
+
+    // a single node with a self loop
+    const auto loop = summary_query::getSupernodeNeighbors(graph, 3);
+    ASSERT_EQ(loop.size(), static_cast<size_t>(1));
+    EXPECT_DOUBLE_EQ(loop[0].second, 2.0);
+}
\ No newline at end of file
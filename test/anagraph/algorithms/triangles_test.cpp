@@ -0,0 +1,109 @@
+#include "anagraph/algorithms/triangles.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+    const std::string datasetFile = datasetDirectory + "/zackary_karate.txt";
+
+    anagraph::graph_structure::Graph randomGraph(int nodes, int edges, unsigned int seed) {
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution<int> distribution(0, nodes - 1);
+        anagraph::graph_structure::Graph graph;
+        for (int i = 0; i < edges; i++) {
+            graph.setEdge(distribution(engine), distribution(engine));
+        }
+        return graph;
+    }
+}
+
+TEST(TrianglesTest, Karate) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    const graph_structure::Graph graph(datasetFile, FileExtension::TXT);
+    EXPECT_EQ(triangles::countTriangles(graph), 45u);
+    EXPECT_EQ(triangles::countTriangles(graph, 4), 45u);
+
+    const std::vector<double> coefficients = triangles::clusteringCoefficients(graph);
+    double sum = 0.0;
+    for (const double coefficient : coefficients) {
+        sum += coefficient;
+    }
+    EXPECT_NEAR(sum / coefficients.size(), 0.5706384782076823, 1e-12);
+    EXPECT_EQ(triangles::clusteringCoefficients(graph, 4), coefficients);
+}
+
+TEST(TrianglesTest, SelfLoopAndWeights) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::info);
+    graph_structure::WeightedGraph graph;
+    graph.setEdge(1, 2, 0.5);
+    graph.setEdge(2, 3, 2.0);
+    graph.setEdge(3, 1, 1.0);
+    graph.setEdge(3, 4, 1.0);
+    graph.setEdge(3, 3, 1.0);
+    graph.setNode(5);
+
+    EXPECT_EQ(triangles::countTriangles(graph), 1u);
+    const std::vector<double> expected = {1.0, 1.0, 1.0 / 3, 0.0, 0.0};
+    EXPECT_EQ(triangles::clusteringCoefficients(graph), expected);
+    EXPECT_EQ(triangles::countNodeTriangles(graph_structure::CompressedGraph(graph), 2), std::vector<size_t>({1, 1, 1, 0, 0}));
+}
+
+TEST(TrianglesTest, BruteForce) {
+    using namespace anagraph;
+    const graph_structure::Graph graph = randomGraph(200, 2000, 7);
+    const graph_structure::CompressedGraph compressed(graph);
+    std::vector<size_t> expected(compressed.size(), 0);
+    auto isAdjacent = [&](int src, int dst) {
+        const auto adjacents = compressed.getAdjacents(src);
+        return std::binary_search(adjacents.begin(), adjacents.end(), dst);
+    };
+    size_t total = 0;
+    for (size_t u = 0; u < compressed.size(); u++) {
+        for (size_t v = u + 1; v < compressed.size(); v++) {
+            for (size_t w = v + 1; w < compressed.size() && isAdjacent(u, v); w++) {
+                if (isAdjacent(u, w) && isAdjacent(v, w)) {
+                    expected[u]++;
+                    expected[v]++;
+                    expected[w]++;
+                    total++;
+                }
+            }
+        }
+    }
+
+    for (int numThreads : {1, 3, 8}) {
+        EXPECT_EQ(triangles::countTriangles(compressed, numThreads), total);
+        EXPECT_EQ(triangles::countNodeTriangles(compressed, numThreads), expected);
+    }
+}
+
+TEST(TrianglesTest, WedgeSampling) {
+    using namespace anagraph;
+    const graph_structure::Graph graph = randomGraph(300, 6000, 11);
+    const double exact = triangles::countTriangles(graph);
+    const double estimate = triangles::estimateTriangles(graph, 100000);
+    EXPECT_NEAR(estimate, exact, exact * 0.05);
+    EXPECT_EQ(triangles::estimateTriangles(graph, 100000, 4), estimate);
+
+    const std::vector<double> coefficients = triangles::clusteringCoefficients(graph);
+    double average = 0.0;
+    for (const double coefficient : coefficients) {
+        average += coefficient / coefficients.size();
+    }
+    const double averageEstimate = triangles::estimateAverageClustering(graph, 100000);
+    EXPECT_NEAR(averageEstimate, average, 0.01);
+    EXPECT_EQ(triangles::estimateAverageClustering(graph, 100000, 4), averageEstimate);
+
+    ASSERT_THROW(triangles::estimateTriangles(graph, 0), std::invalid_argument);
+    EXPECT_EQ(triangles::estimateTriangles(graph_structure::Graph(), 10), 0.0);
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "anagraph/algorithms/vector_kernels.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    const std::vector<anagraph::kernels::SimdLevel> levels = {
+        anagraph::kernels::SimdLevel::SCALAR,
+        anagraph::kernels::SimdLevel::AVX2,
+        anagraph::kernels::SimdLevel::AVX512,
+    };
+
+    std::vector<double> randomDistribution(size_t size, unsigned int seed) {
+        std::mt19937 engine(seed);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        std::vector<double> values(size);
+        double sum = 0.0;
+        for (double &value : values) {
+            value = distribution(engine);
+            sum += value;
+        }
+        for (double &value : values) {
+            value /= sum;
+        }
+        return values;
+    }
+}
+
+TEST(VectorKernelsTest, SimdLevel) {
+    using namespace anagraph;
+    ASSERT_TRUE(kernels::isSupported(kernels::SimdLevel::SCALAR));
+    ASSERT_TRUE(kernels::isSupported(kernels::getSimdLevel()));
+    spdlog::info("SIMD level: {}", static_cast<int>(kernels::getSimdLevel()));
+}
+
+TEST(VectorKernelsTest, DotAndNorms) {
+    using namespace anagraph;
+    // the sizes cover the partial blocks of every vector width
+    for (size_t size : {0, 1, 3, 4, 5, 8, 13, 1000}) {
+        const std::vector<double> v1 = randomDistribution(size, 1);
+        const std::vector<double> v2 = randomDistribution(size, 2);
+        double dot = 0.0;
+        double norm1 = 0.0;
+        double norm2 = 0.0;
+        for (size_t i = 0; i < size; i++) {
+            dot += v1[i] * v2[i];
+            norm1 += v1[i] * v1[i];
+            norm2 += v2[i] * v2[i];
+        }
+        for (const auto level : levels) {
+            if (!kernels::isSupported(level)) {
+                ASSERT_THROW(kernels::dot(v1.data(), v2.data(), size, level), std::invalid_argument);
+                continue;
+            }
+            ASSERT_NEAR(kernels::dot(v1.data(), v2.data(), size, level), dot, 1e-12);
+            const kernels::DotProducts products = kernels::dotAndNorms(v1.data(), v2.data(), size, level);
+            ASSERT_NEAR(products.dot, dot, 1e-12);
+            ASSERT_NEAR(products.squaredNorm1, norm1, 1e-12);
+            ASSERT_NEAR(products.squaredNorm2, norm2, 1e-12);
+        }
+    }
+}
+
+TEST(VectorKernelsTest, Divergences) {
+    using namespace anagraph;
+    for (size_t size : {1, 3, 4, 5, 8, 13, 1000}) {
+        std::vector<double> p = randomDistribution(size, 3);
+        const std::vector<double> q = randomDistribution(size, 4);
+        // zeros of p are skipped, and subnormal values fall back to the scalar log2
+        p[0] = 0.0;
+        if (size > 2) {
+            p[2] = 1e-310;
+        }
+        double kl = 0.0;
+        double js = 0.0;
+        for (size_t i = 0; i < size; i++) {
+            const double m = (p[i] + q[i]) / 2;
+            if (p[i] != 0.0) {
+                kl += p[i] * std::log2(p[i] / q[i]);
+                js += p[i] * std::log2(p[i] / m) / 2;
+            }
+            js += q[i] * std::log2(q[i] / m) / 2;
+        }
+        for (const auto level : levels) {
+            if (!kernels::isSupported(level)) {
+                continue;
+            }
+            ASSERT_NEAR(kernels::klDivergence(p.data(), q.data(), size, level), kl, 1e-12);
+            ASSERT_NEAR(kernels::jsDivergence(p.data(), q.data(), size, level), js, 1e-12);
+            ASSERT_NEAR(kernels::jsDivergence(q.data(), p.data(), size, level), js, 1e-12);
+        }
+    }
+}
+
+TEST(VectorKernelsTest, KLdivergenceWithZero) {
+    using namespace anagraph;
+    const std::vector<double> p = {0.1, 0.2, 0.3, 0.1, 0.1, 0.1, 0.1};
+    const std::vector<double> q = {0.2, 0.2, 0.2, 0.1, 0.1, 0.2, 0.0};
+    for (const auto level : levels) {
+        if (!kernels::isSupported(level)) {
+            continue;
+        }
+        ASSERT_THROW(kernels::klDivergence(p.data(), q.data(), p.size(), level), std::invalid_argument);
+        ASSERT_NO_THROW(kernels::klDivergence(q.data(), p.data(), p.size(), level));
+    }
+}
+
+TEST(VectorKernelsTest, IntersectionSize) {
+    using namespace anagraph;
+    std::mt19937 engine(5);
+    // the sizes cover the partial blocks, and the densities cover both sparse and dense overlaps
+    for (size_t size : {0, 1, 7, 8, 16, 17, 100, 1000}) {
+        for (int range : {2, 10}) {
+            std::uniform_int_distribution<int> distribution(0, static_cast<int>(size) * range);
+            std::vector<int> a;
+            std::vector<int> b;
+            for (size_t i = 0; i < size; i++) {
+                a.push_back(distribution(engine));
+                b.push_back(distribution(engine));
+            }
+            for (auto *v : {&a, &b}) {
+                std::sort(v->begin(), v->end());
+                v->erase(std::unique(v->begin(), v->end()), v->end());
+            }
+            std::vector<int> common;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(common));
+            for (const auto level : levels) {
+                if (!kernels::isSupported(level)) {
+                    ASSERT_THROW(kernels::intersectionSize(a.data(), a.size(), b.data(), b.size(), level), std::invalid_argument);
+                    continue;
+                }
+                ASSERT_EQ(kernels::intersectionSize(a.data(), a.size(), b.data(), b.size(), level), common.size());
+                ASSERT_EQ(kernels::intersectionSize(b.data(), b.size(), a.data(), a.size(), level), common.size());
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "anagraph/components/compressed_graph.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
+
+    template <typename T>
+    std::vector<T> toVector(std::span<const T> span) {
+        return std::vector<T>(span.begin(), span.end());
+    }
+}
+
+TEST(CompressedGraphTest, WeightedDigraph) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph graph;
+    graph.setNode(7);
+    graph.setEdge(10, 3, 1.0);
+    graph.setEdge(3, 10, 2.0);
+    graph.setEdge(3, 7, 0.5);
+    graph.setEdge(3, 3, 4.0);
+
+    graph_structure::CompressedGraph compressed(graph);
+    EXPECT_EQ(compressed.size(), static_cast<size_t>(3));
+    EXPECT_EQ(compressed.edgeSize(), static_cast<size_t>(4));
+    EXPECT_EQ(toVector(compressed.getIds()), std::vector<int>({3, 7, 10}));
+    EXPECT_EQ(compressed.getIndex(10), 2);
+    EXPECT_EQ(compressed.getId(1), 7);
+    EXPECT_THROW(compressed.getIndex(5), std::out_of_range);
+
+    EXPECT_EQ(toVector(compressed.getOffsets()), std::vector<size_t>({0, 3, 3, 4}));
+    EXPECT_EQ(toVector(compressed.getAdjacents(0)), std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(toVector(compressed.getWeights(0)), std::vector<double>({4.0, 0.5, 2.0}));
+    EXPECT_EQ(compressed.getDegree(1), static_cast<size_t>(0));
+    EXPECT_EQ(toVector(compressed.getAdjacents(2)), std::vector<int>({0}));
+}
+
+TEST(CompressedGraphTest, Graph) {
+    using namespace anagraph;
+    graph_structure::Graph graph;
+    graph.setEdge(0, 1);
+    graph.setEdge(1, 2);
+
+    graph_structure::CompressedGraph compressed(graph);
+    EXPECT_EQ(compressed.edgeSize(), static_cast<size_t>(4));
+    EXPECT_EQ(toVector(compressed.getAdjacents(1)), std::vector<int>({0, 2}));
+    EXPECT_EQ(toVector(compressed.getWeights(1)), std::vector<double>({1.0, 1.0}));
+}
+
+TEST(CompressedGraphTest, Transpose) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph graph;
+    graph.setEdge(0, 2, 1.0);
+    graph.setEdge(1, 2, 2.0);
+    graph.setEdge(2, 0, 3.0);
+
+    graph_structure::CompressedGraph transposed = graph_structure::CompressedGraph(graph).transpose();
+    EXPECT_EQ(toVector(transposed.getAdjacents(0)), std::vector<int>({2}));
+    EXPECT_EQ(toVector(transposed.getAdjacents(1)), std::vector<int>());
+    EXPECT_EQ(toVector(transposed.getAdjacents(2)), std::vector<int>({0, 1}));
+    EXPECT_EQ(toVector(transposed.getWeights(2)), std::vector<double>({1.0, 2.0}));
+}
+
+TEST(CompressedGraphTest, ReadGraph) {
+    using namespace anagraph;
+    const std::string filePath = datasetDirectory + "/zackary_karate.txt";
+    graph_structure::WeightedGraph graph(filePath, FileExtension::TXT);
+
+    graph_structure::CompressedGraph compressed(graph);
+    EXPECT_EQ(compressed.size(), graph.size());
+    for (size_t index = 0; index < compressed.size(); index++) {
+        const int id = compressed.getId(index);
+        EXPECT_EQ(compressed.getDegree(index), graph.getAdjacents(id).size());
+        const auto weights = compressed.getWeights(index);
+        EXPECT_DOUBLE_EQ(std::reduce(weights.begin(), weights.end()), graph.getAdjacents(id).size());
+    }
+}
\ No newline at end of file
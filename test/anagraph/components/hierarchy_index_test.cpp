@@ -0,0 +1,130 @@
+#include "anagraph/components/hierarchy_index.hpp"
+#include "anagraph/components/weighted_directed_supergraph.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    /**
+     * @brief The hierarchy 100 -> {10, 20}, 10 -> {1, 2}, 20 -> {3}, and a single node 4.
+     */
+    anagraph::graph_structure::WeightedSuperDigraph hierarchy() {
+        anagraph::graph_structure::WeightedSuperDigraph graph;
+        graph.setEdge(1, 2, 1.0);
+        graph.setEdge(3, 4, 1.0);
+        graph.setParent(1, 10);
+        graph.setParent(2, 10);
+        graph.setParent(3, 20);
+        graph.setParent(10, 100);
+        graph.setParent(20, 100);
+        return graph;
+    }
+
+    std::vector<int> toVector(std::span<const int> leaves) {
+        return std::vector<int>(leaves.begin(), leaves.end());
+    }
+}
+
+TEST(HierarchyIndexTest, Queries) {
+    using namespace anagraph::graph_structure;
+    spdlog::set_level(spdlog::level::debug);
+    const WeightedSuperDigraph graph = hierarchy();
+    const HierarchyIndex &index = graph.getHierarchyIndex();
+
+    EXPECT_EQ(index.size(), static_cast<size_t>(7));
+    EXPECT_TRUE(index.isAncestor(100, 1));
+    EXPECT_TRUE(index.isAncestor(10, 2));
+    EXPECT_TRUE(index.isAncestor(3, 3));
+    EXPECT_FALSE(index.isAncestor(10, 3));
+    EXPECT_FALSE(index.isAncestor(1, 100));
+    EXPECT_FALSE(index.isAncestor(100, 4));
+
+    EXPECT_EQ(toVector(index.getLeaves(100)), std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(toVector(index.getLeaves(10)), std::vector<int>({1, 2}));
+    EXPECT_EQ(toVector(index.getLeaves(4)), std::vector<int>({4}));
+    EXPECT_EQ(index.getLeafCount(20), static_cast<size_t>(1));
+
+    EXPECT_EQ(index.getRoot(2), 100);
+    EXPECT_EQ(index.getDepth(2), 2);
+    EXPECT_EQ(index.getDepth(100), 0);
+    EXPECT_EQ(index.getLowestCommonAncestor(1, 2), 10);
+    EXPECT_EQ(index.getLowestCommonAncestor(1, 3), 100);
+    EXPECT_EQ(index.getLowestCommonAncestor(2, 10), 10);
+    EXPECT_EQ(index.getLowestCommonAncestor(1, 4), WeightedSupernode::ROOT);
+
+    EXPECT_THROW(index.isAncestor(100, 5), std::out_of_range);
+}
+
+TEST(HierarchyIndexTest, Update) {
+    using namespace anagraph::graph_structure;
+    spdlog::set_level(spdlog::level::debug);
+    WeightedSuperDigraph graph = hierarchy();
+    graph.getHierarchyIndex();
+
+    // move 20 under the single node, and detach 2
+    graph.updateParent(20, 4);
+    graph.removeParent(2);
+    const HierarchyIndex &index = graph.getHierarchyIndex();
+    EXPECT_EQ(toVector(index.getLeaves(100)), std::vector<int>({1}));
+    EXPECT_EQ(toVector(index.getLeaves(4)), std::vector<int>({3}));
+    EXPECT_EQ(index.getRoot(3), 4);
+    EXPECT_EQ(index.getRoot(2), 2);
+    EXPECT_EQ(index.getLowestCommonAncestor(1, 3), WeightedSupernode::ROOT);
+
+    // the children of a removed node become roots
+    graph.removeNode(10);
+    const HierarchyIndex &removed = graph.getHierarchyIndex();
+    EXPECT_FALSE(removed.contains(10));
+    EXPECT_EQ(removed.getRoot(1), 1);
+    EXPECT_EQ(removed.getLeafCount(100), static_cast<size_t>(1));
+
+}
+
+TEST(HierarchyIndexTest, ConcurrentReaders) {
+    using namespace anagraph::graph_structure;
+    spdlog::set_level(spdlog::level::info);
+    WeightedSuperDigraph graph = hierarchy();
+    graph.getHierarchyIndex();
+    graph.updateParent(20, 4);
+
+    // the pending change is applied by only one of the readers
+    const WeightedSuperDigraph &reader = graph;
+    std::vector<int> roots(8, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < roots.size(); i++) {
+        threads.emplace_back([&, i]() {
+            roots[i] = reader.getHierarchyIndex().getRoot(3);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(roots, std::vector<int>(roots.size(), 4));
+
+    // the copy has its own mutex and index
+    const WeightedSuperDigraph copied = graph;
+    graph.removeParent(3);
+    EXPECT_EQ(copied.getHierarchyIndex().getRoot(3), 4);
+    EXPECT_EQ(graph.getHierarchyIndex().getRoot(3), 3);
+}
+
+TEST(HierarchyIndexTest, DeepChain) {
+    using namespace anagraph::graph_structure;
+    spdlog::set_level(spdlog::level::info);
+    WeightedSuperDigraph graph;
+    const int depth = 1000;
+    for (int i = 0; i < depth; i++) {
+        graph.setParent(i + 1, i);
+    }
+    graph.setParent(2000, 300);
+    const HierarchyIndex &index = graph.getHierarchyIndex();
+    EXPECT_EQ(index.getDepth(depth), depth);
+    EXPECT_EQ(toVector(index.getLeaves(0)), std::vector<int>({depth, 2000}));
+    EXPECT_EQ(index.getLowestCommonAncestor(depth, 517), 517);
+    EXPECT_EQ(index.getLowestCommonAncestor(2000, depth), 300);
+    EXPECT_TRUE(index.isAncestor(3, 999));
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "anagraph/components/subgraph_view.hpp"
+#include "anagraph/components/weighted_graph.hpp"
+#include "anagraph/components/unweighted_graph.hpp"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <vector>
+
+TEST(SubgraphViewTest, WeightedDigraph) {
+    using namespace anagraph;
+    spdlog::set_level(spdlog::level::debug);
+    graph_structure::WeightedDigraph graph;
+    graph.setEdge(0, 1, 5.0);
+    graph.setEdge(0, 2, 2.5);
+    graph.setEdge(1, 3, 3.0);
+    graph.setEdge(3, 0, 1.5);
+
+    graph_structure::SubgraphView<graph_structure::WeightedDigraph> view(graph, std::unordered_set<int>({0, 1, 3}));
+    EXPECT_EQ(view.size(), static_cast<size_t>(3));
+    EXPECT_EQ(view.getIds(), std::vector<int>({0, 1, 3}));
+    EXPECT_TRUE(view.contains(3));
+    EXPECT_FALSE(view.contains(2));
+    EXPECT_FALSE(view.contains(-1));
+    EXPECT_FALSE(view.contains(100));
+
+    std::vector<std::pair<int, double>> adjacents;
+    for (const auto &[adj, weight] : view.getAdjacents(0)) {
+        spdlog::debug("adj: {}, weight: {}", adj, weight);
+        adjacents.emplace_back(adj, weight);
+    }
+    ASSERT_EQ(adjacents.size(), static_cast<size_t>(1));
+    EXPECT_EQ(adjacents[0].first, 1);
+    EXPECT_DOUBLE_EQ(adjacents[0].second, 5.0);
+    EXPECT_THROW(view.getAdjacents(2), std::out_of_range);
+
+    // the edges added to the parent graph are visible, while the nodes of the view are fixed
+    graph.setEdge(0, 3, 4.0);
+    EXPECT_EQ(std::ranges::distance(view.getAdjacents(0)), 2);
+    graph.setEdge(0, 4, 1.0);
+    EXPECT_FALSE(view.contains(4));
+    EXPECT_EQ(std::ranges::distance(view.getAdjacents(0)), 2);
+}
+
+TEST(SubgraphViewTest, Graph) {
+    using namespace anagraph;
+    graph_structure::Graph graph;
+    graph.setEdge(-2, 0);
+    graph.setEdge(0, 1);
+    graph.setEdge(1, 5);
+    graph.setEdge(5, -2);
+
+    graph_structure::SubgraphView<graph_structure::Graph> view(graph, std::vector<int>({5, -2, 1, 5}));
+    EXPECT_EQ(view.getIds(), std::vector<int>({-2, 1, 5}));
+
+    std::vector<int> adjacents;
+    for (int adj : view.getAdjacents(5)) {
+        adjacents.push_back(adj);
+    }
+    std::sort(adjacents.begin(), adjacents.end());
+    EXPECT_EQ(adjacents, std::vector<int>({-2, 1}));
+    EXPECT_EQ(std::ranges::distance(view.getAdjacents(-2)), 1);
+}
+
+TEST(SubgraphViewTest, SparseIds) {
+    using namespace anagraph;
+    graph_structure::Graph graph;
+    graph.setEdge(3, 900000000);
+    graph.setEdge(3, 7);
+    graph.setEdge(900000000, -900000000);
+
+    // the range of the ids is too wide for the bitmap
+    graph_structure::SubgraphView<graph_structure::Graph> view(graph, std::vector<int>({3, 900000000, -900000000}));
+    EXPECT_TRUE(view.contains(900000000));
+    EXPECT_TRUE(view.contains(-900000000));
+    EXPECT_FALSE(view.contains(7));
+    EXPECT_EQ(std::ranges::distance(view.getAdjacents(3)), 1);
+    EXPECT_EQ(std::ranges::distance(view.getAdjacents(900000000)), 2);
+    EXPECT_THROW(view.getAdjacents(7), std::out_of_range);
+}
+
+TEST(SubgraphViewTest, NodeDoesNotExist) {
+    using namespace anagraph;
+    graph_structure::Digraph graph;
+    graph.setEdge(0, 1);
+
+    using View = graph_structure::SubgraphView<graph_structure::Digraph>;
+    EXPECT_THROW(View(graph, std::unordered_set<int>({0, 2})), std::out_of_range);
+    EXPECT_EQ(View(graph, std::vector<int>()).size(), static_cast<size_t>(0));
+}
+
+TEST(SubgraphViewTest, Materialize) {
+    using namespace anagraph;
+    graph_structure::WeightedGraph graph;
+    graph.setEdge(0, 1, 5.0);
+    graph.setEdge(0, 2, 2.5);
+    graph.setEdge(1, 3, 3.0);
+
+    graph_structure::SubgraphView<graph_structure::WeightedGraph> view(graph, std::unordered_set<int>({0, 1, 3}));
+    graph_structure::WeightedGraph subgraph = view.materialize();
+    EXPECT_EQ(subgraph.size(), static_cast<size_t>(3));
+    EXPECT_DOUBLE_EQ(subgraph.getWeight(0, 1), 5.0);
+    EXPECT_DOUBLE_EQ(subgraph.getWeight(3, 1), 3.0);
+    EXPECT_EQ(subgraph.getAdjacents(0).size(), static_cast<size_t>(1));
+    EXPECT_THROW(subgraph.getWeight(0, 2), std::out_of_range);
+
+    // the parent graph is not modified
+    EXPECT_EQ(graph.size(), static_cast<size_t>(4));
+    EXPECT_DOUBLE_EQ(graph.getWeight(0, 2), 2.5);
+}
\ No newline at end of file
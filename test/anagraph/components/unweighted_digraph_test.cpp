@@ -147,6 +147,25 @@ TEST(DigraphTest, Reorganize) {
     EXPECT_FALSE(graph.getAdjacents(2).contains(4));
 }
 
+TEST(DigraphTest, Relabel) {
+    using namespace anagraph::graph_structure;
+    Digraph graph;
+    graph.setEdge(0, 1);
+    graph.setEdge(1, 2);
+    graph.setEdge(2, 0);
+
+    graph.relabel({{0, 2}, {1, 0}, {2, 1}}, 2);
+    EXPECT_EQ(graph.size(), static_cast<size_t>(3));
+    EXPECT_EQ(graph.getNode(0).getId(), 0);
+    EXPECT_TRUE(graph.getAdjacents(2).contains(0));
+    EXPECT_TRUE(graph.getAdjacents(0).contains(1));
+    EXPECT_TRUE(graph.getAdjacents(1).contains(2));
+    EXPECT_EQ(graph.getAdjacents(2).size(), static_cast<size_t>(1));
+
+    EXPECT_THROW(graph.relabel({{0, 1}, {1, 1}, {2, 2}}), std::invalid_argument);
+    EXPECT_THROW(graph.relabel({{0, 1}, {1, 0}}), std::invalid_argument);
+}
+
 TEST(DigraphTest, ReadGraph) {
     using namespace anagraph::graph_structure;
     Digraph graph;
@@ -3,9 +3,11 @@
 #include <gtest/gtest.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <any>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace {
     const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
@@ -67,6 +69,20 @@ TEST(GraphTest, GetIDs) {
     EXPECT_FALSE(ids.contains(7));
 }
 
+TEST(GraphTest, GetIdRange) {
+    using namespace anagraph::graph_structure;
+    Graph graph;
+    graph.setEdge(3, 1);
+    graph.setEdge(1, 0);
+
+    std::vector<int> ids;
+    for (int id : graph.getIdRange()) {
+        ids.push_back(id);
+    }
+    EXPECT_EQ(ids, std::vector<int>({0, 1, 3}));
+    EXPECT_EQ(graph.getIdRange().size(), static_cast<size_t>(3));
+}
+
 TEST(GraphTest, SetEdge) {
     using namespace anagraph::graph_structure;
     spdlog::set_level(spdlog::level::debug);
@@ -102,6 +118,24 @@ TEST(GraphTest, RemoveEdge) {
     EXPECT_FALSE(graph.getAdjacents(1).contains(0));
 }
 
+TEST(GraphTest, GetEdges) {
+    using namespace anagraph;
+    using namespace anagraph::graph_structure;
+    Graph graph;
+    graph.setEdge(0, 1);
+    graph.setEdge(2, 1);
+    graph.setEdge(2, 2);
+
+    std::vector<EdgeObject> edges(graph.getEdges().begin(), graph.getEdges().end());
+    std::sort(edges.begin(), edges.end());
+    EXPECT_EQ(edges, std::vector<EdgeObject>({{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 2}}));
+
+    const auto uniqueRange = graph.getEdges(true);
+    std::vector<EdgeObject> uniqueEdges(uniqueRange.begin(), uniqueRange.end());
+    std::sort(uniqueEdges.begin(), uniqueEdges.end());
+    EXPECT_EQ(uniqueEdges, std::vector<EdgeObject>({{0, 1}, {1, 2}, {2, 2}}));
+}
+
 TEST(GraphTest, GetSubgraph) {
     using namespace anagraph::graph_structure;
     spdlog::set_level(spdlog::level::debug);
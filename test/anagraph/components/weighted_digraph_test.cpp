@@ -3,9 +3,11 @@
 #include <gtest/gtest.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <any>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace {
     const std::string datasetDirectory = PROJECT_SOURCE_DIR + std::string("/dataset");
@@ -67,6 +69,31 @@ TEST(WeightedDigraphTest, GetIDs) {
     EXPECT_FALSE(ids.contains(7));
 }
 
+TEST(WeightedDigraphTest, GetIdRange) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph graph;
+    graph.setNode(5);
+    graph.setNode(0);
+    graph.setNode(2);
+
+    IdRange ids = graph.getIdRange();
+    EXPECT_EQ(ids.size(), static_cast<size_t>(3));
+    EXPECT_FALSE(ids.empty());
+    std::vector<int> visited(ids.begin(), ids.end());
+    EXPECT_EQ(visited, std::vector<int>({0, 2, 5}));
+
+    // iterators are copyable and compare equal at the same position
+    auto it = ids.begin();
+    auto copy = it++;
+    EXPECT_EQ(*copy, 0);
+    EXPECT_EQ(*it, 2);
+    EXPECT_TRUE(++copy == it);
+
+    graph_structure::WeightedDigraph empty;
+    EXPECT_TRUE(empty.getIdRange().empty());
+    EXPECT_TRUE(empty.getIdRange().begin() == empty.getIdRange().end());
+}
+
 TEST(WeightedDigraphTest, SetEdge) {
     using namespace anagraph;
     spdlog::set_level(spdlog::level::debug);
@@ -122,6 +149,25 @@ TEST(WeightedDigraphTest, GetAdjacents) {
     EXPECT_DOUBLE_EQ(adjacents.at(2), 2.5);
 }
 
+TEST(WeightedDigraphTest, GetEdges) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph graph;
+    graph.setNode(3);
+    graph.setEdge(2, 0, 1.5);
+    graph.setEdge(0, 1, 5.0);
+    graph.setEdge(0, 2, 2.5);
+
+    std::vector<WeightedEdgeObject> edges;
+    for (const auto &[src, dst, weight] : graph.getEdges()) {
+        edges.emplace_back(src, dst, weight);
+    }
+    std::sort(edges.begin(), edges.end());
+    EXPECT_EQ(edges, std::vector<WeightedEdgeObject>({{0, 1, 5.0}, {0, 2, 2.5}, {2, 0, 1.5}}));
+
+    graph_structure::WeightedDigraph empty;
+    EXPECT_TRUE(empty.getEdges().begin() == empty.getEdges().end());
+}
+
 TEST(WeightedDigraphTest, GetSubgraph) {
     using namespace anagraph;
     spdlog::set_level(spdlog::level::debug);
@@ -167,6 +213,25 @@ TEST(WeightedDigraphTest, Reorganize) {
     EXPECT_THROW(graph.getWeight(2, 4), std::out_of_range);
 }
 
+TEST(WeightedDigraphTest, Relabel) {
+    using namespace anagraph;
+    graph_structure::WeightedDigraph graph;
+    graph.setEdge(0, 1, 5.0);
+    graph.setEdge(1, 2, 3.5);
+    graph.setEdge(2, 0, 1.5);
+
+    graph.relabel({{0, 2}, {1, 0}, {2, 1}}, 2);
+    EXPECT_EQ(graph.size(), static_cast<size_t>(3));
+    EXPECT_EQ(graph.getNode(2).getId(), 2);
+    EXPECT_DOUBLE_EQ(graph.getWeight(2, 0), 5.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(0, 1), 3.5);
+    EXPECT_DOUBLE_EQ(graph.getWeight(1, 2), 1.5);
+    EXPECT_DOUBLE_EQ(graph.getWeight(0, 2), 0.0);
+
+    EXPECT_THROW(graph.relabel({{0, 1}, {1, 1}, {2, 2}}), std::invalid_argument);
+    EXPECT_THROW(graph.relabel({{0, 1}, {1, 0}}), std::invalid_argument);
+}
+
 TEST(WeightedDigraphTest, ReadGraph) {
     using namespace anagraph;
     graph_structure::WeightedDigraph graph;
@@ -410,4 +410,72 @@ TEST(WeightedSuperDigraphTest, WriteGraph) {
 
     const std::string outputDir = datasetDirectory + "/output/directed_supergraph_test";
     graph.writeGraph(outputDir, anagraph::FileExtension::TXT);
+}
+
+TEST(WeightedSuperDigraphTest, MergeNodes) {
+    using namespace anagraph::graph_structure;
+    WeightedSuperDigraph graph;
+    graph.setEdge(1, 2, 1.0);
+    graph.setEdge(2, 3, 2.0);
+    graph.setEdge(3, 4, 1.0);
+    graph.setEdge(4, 1, 0.5);
+    graph.setEdge(5, 6, 3.0);
+    graph.setEdge(1, 5, 1.0);
+    graph.setEdge(6, 3, 2.0);
+
+    const auto merged = graph.mergeNodes({{1, 2}, {3, 4}, {2, 1}});
+    EXPECT_EQ(merged.size(), static_cast<size_t>(4));
+    const int first = merged.at(1);
+    const int second = merged.at(3);
+    EXPECT_EQ(merged.at(2), first);
+    EXPECT_EQ(merged.at(4), second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(graph.size(), static_cast<size_t>(8));
+
+    // the hierarchy is recorded, and the members keep their edges
+    EXPECT_EQ(graph.getParent(1), first);
+    EXPECT_EQ(graph.getParent(4), second);
+    EXPECT_EQ(graph.getChildren(first), std::unordered_set<int>({1, 2}));
+    EXPECT_DOUBLE_EQ(graph.getWeight(1, 2), 1.0);
+
+    EXPECT_DOUBLE_EQ(graph.getWeight(first, first), 1.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(first, second), 2.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(second, second), 1.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(second, first), 0.5);
+    EXPECT_DOUBLE_EQ(graph.getWeight(first, 5), 1.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(6, second), 2.0);
+    EXPECT_EQ(graph.getAdjacents(5).size(), static_cast<size_t>(1));
+
+    // merge the next level, the parallel edges are summed
+    const int third = graph.mergeNodes({{first, 5}}).at(5);
+    EXPECT_EQ(graph.getParent(first), third);
+    EXPECT_DOUBLE_EQ(graph.getWeight(third, third), 2.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(third, second), 2.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(second, third), 0.5);
+    EXPECT_DOUBLE_EQ(graph.getWeight(third, 6), 3.0);
+
+    EXPECT_THROW(graph.mergeNodes({{1, 6}}), std::invalid_argument);
+    EXPECT_THROW(graph.mergeNodes({{100, 6}}), std::out_of_range);
+    EXPECT_TRUE(graph.mergeNodes({}).empty());
+}
+
+TEST(WeightedSuperDigraphTest, MergeNodesAfterCounterReset) {
+    using namespace anagraph::graph_structure;
+    WeightedSuperDigraph graph;
+    for (int i = 0; i < 4; i++) {
+        graph.setEdge(i, (i + 1) % 4, 1.0);
+    }
+
+    // the global counter points at an existing node, but the new supernode takes a fresh id
+    WeightedSupernode::resetNodesCount();
+    const auto merged = graph.mergeNodes({{2, 3}});
+    const int supernode = merged.at(2);
+    EXPECT_EQ(merged.at(3), supernode);
+    EXPECT_EQ(supernode, 4);
+    EXPECT_EQ(graph.size(), 5u);
+    EXPECT_TRUE(graph.getChildren(0).empty());
+    EXPECT_EQ(graph.getChildren(supernode), std::unordered_set<int>({2, 3}));
+    EXPECT_DOUBLE_EQ(graph.getWeight(supernode, supernode), 1.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(supernode, 0), 1.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(1, supernode), 1.0);
 }
\ No newline at end of file
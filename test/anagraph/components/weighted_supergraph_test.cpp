@@ -507,4 +507,25 @@ TEST(WeightedSupergraphTest, WriteGraph) {
 
     const std::string outputDir = datasetDirectory + "/output/undirected_supergraph_test";
     graph.writeGraph(outputDir, anagraph::FileExtension::TXT);
+}
+
+TEST(WeightedSupergraphTest, MergeNodes) {
+    using namespace anagraph::graph_structure;
+    WeightedSupergraph graph;
+    graph.setEdge(1, 2, 1.0);
+    graph.setEdge(1, 1, 0.5);
+    graph.setEdge(2, 3, 2.0);
+    graph.setEdge(1, 3, 1.0);
+    graph.setEdge(3, 4, 1.5);
+
+    const auto merged = graph.mergeNodes({{1, 2}});
+    const int supernode = merged.at(1);
+    EXPECT_EQ(merged.at(2), supernode);
+    EXPECT_EQ(graph.getChildren(supernode), std::unordered_set<int>({1, 2}));
+
+    // each undirected edge inside the group is counted once
+    EXPECT_DOUBLE_EQ(graph.getWeight(supernode, supernode), 1.5);
+    EXPECT_DOUBLE_EQ(graph.getWeight(supernode, 3), 3.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(3, supernode), 3.0);
+    EXPECT_DOUBLE_EQ(graph.getWeight(3, 4), 1.5);
 }
\ No newline at end of file